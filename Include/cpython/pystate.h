@@ -107,6 +107,19 @@ typedef struct _stack_chunk {
     PyObject * data[1]; /* Variable sized */
 } _PyStackChunk;
 
+/* GIL statistics of a thread or an interpreter, see sys._get_gil_stats().
+   The hold durations are only measured while GIL timing is enabled; the
+   histogram buckets are < 1 us, < 10 us, ..., < 100 ms and >= 100 ms. */
+#define _Py_GIL_HOLD_HISTOGRAM_SIZE 7
+
+typedef struct {
+    uint64_t acquisitions;
+    uint64_t forced_drops;
+    int64_t wait_ns;
+    int64_t hold_ns;
+    uint64_t hold_histogram[_Py_GIL_HOLD_HISTOGRAM_SIZE];
+} _PyGILStats;
+
 struct _ts {
     /* See Python/ceval.c for comments explaining most fields */
 
@@ -211,6 +224,13 @@ struct _ts {
     PyObject **datastack_limit;
     /* XXX signal handlers should also be here */
 
+    /* GIL scheduling, see Python/ceval_gil.c.  Set if another thread
+       asked for the GIL while this thread held it the last time. */
+    int gil_cpu_bound;
+    /* When the thread took the GIL, if GIL timing is enabled, else 0. */
+    int64_t gil_hold_start;
+    _PyGILStats gil_stats;
+
     /* The following fields are here to avoid allocation during init.
        The data is exposed through PyThreadState pointer fields.
        These fields should not be accessed directly outside of init.
@@ -287,6 +307,12 @@ PyAPI_FUNC(PyObject *) _PyThread_CurrentFrames(void);
 */
 PyAPI_FUNC(PyObject *) _PyThread_CurrentExceptions(void);
 
+/* The implementation of sys._get_gil_stats()  Returns a dict of the GIL
+   statistics of the current interpreter, including the statistics of
+   each of its threads.
+*/
+PyAPI_FUNC(PyObject *) _PyThread_GetGILStats(void);
+
 /* Routines for advanced debuggers, requested by David Beazley.
    Don't use unless you know what you are doing! */
 PyAPI_FUNC(PyInterpreterState *) PyInterpreterState_Main(void);
@@ -50,6 +50,9 @@ extern int _PyEval_SetAsyncGenFinalizer(PyObject *);
 extern int _PyEval_GetCoroutineOriginTrackingDepth(void);
 extern int _PyEval_SetCoroutineOriginTrackingDepth(int depth);
 
+extern void _PyEval_SetGILTiming(int enabled);
+extern int _PyEval_GetGILTiming(void);
+
 extern void _PyEval_Fini(void);
 
 
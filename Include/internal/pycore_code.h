@@ -237,8 +237,9 @@ extern void _Py_Specialize_ForIter(PyObject *iter, _Py_CODEUNIT *instr, int opar
 
 /* Finalizer function for static codeobjects used in deepfreeze.py */
 extern void _PyStaticCode_Fini(PyCodeObject *co);
-/* Function to intern strings of codeobjects and quicken the bytecode */
-extern int _PyStaticCode_Init(PyCodeObject *co);
+/* Function to intern strings of codeobjects and quicken the bytecode.
+   Exported for applications deep-frozen by Tools/freeze. */
+PyAPI_FUNC(int) _PyStaticCode_Init(PyCodeObject *co);
 
 #ifdef Py_STATS
 
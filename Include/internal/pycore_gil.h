@@ -31,6 +31,13 @@ struct _gil_runtime_state {
     _Py_atomic_int locked;
     /* Number of GIL switches since the beginning. */
     unsigned long switch_number;
+    /* Number of I/O-bound threads waiting for the GIL: while non-zero,
+       CPU-bound threads don't take it. */
+    int priority_waiters;
+    /* Whether the thread holding the GIL was CPU-bound when it took it. */
+    int holder_cpu_bound;
+    /* Whether to measure how long threads hold the GIL. */
+    int timing;
     /* This condition variable allows one or several threads to wait
        until the GIL is released. In addition, the mutex also protects
        the above variables. */
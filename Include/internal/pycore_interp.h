@@ -92,6 +92,9 @@ struct _is {
     struct _ceval_state ceval;
     struct _gc_runtime_state gc;
 
+    /* Totals of the GIL statistics of the interpreter threads. */
+    _PyGILStats gil_stats;
+
     // sys.modules dictionary
     PyObject *modules;
     /* This is the list of module objects for all legacy (single-phase init)
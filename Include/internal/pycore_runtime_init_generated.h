@@ -744,6 +744,7 @@ extern "C" {
     INIT_ID(_handle_fromlist), \
     INIT_ID(_initializing), \
     INIT_ID(_is_text_encoding), \
+    INIT_ID(_isatty_open_only), \
     INIT_ID(_length_), \
     INIT_ID(_lock_unlock_module), \
     INIT_ID(_loop), \
@@ -786,6 +787,7 @@ extern "C" {
     INIT_ID(buffer), \
     INIT_ID(buffer_callback), \
     INIT_ID(buffer_size), \
+    INIT_ID(buffer_threshold), \
     INIT_ID(buffering), \
     INIT_ID(buffers), \
     INIT_ID(bufsize), \
@@ -872,6 +874,7 @@ extern "C" {
     INIT_ID(dst_dir_fd), \
     INIT_ID(duration), \
     INIT_ID(e), \
+    INIT_ID(eager_start), \
     INIT_ID(effective_ids), \
     INIT_ID(element_factory), \
     INIT_ID(encode), \
@@ -961,6 +964,7 @@ extern "C" {
     INIT_ID(instructions), \
     INIT_ID(intern), \
     INIT_ID(intersection), \
+    INIT_ID(is_running), \
     INIT_ID(isatty), \
     INIT_ID(isinstance), \
     INIT_ID(isoformat), \
@@ -1005,6 +1009,7 @@ extern "C" {
     INIT_ID(loop), \
     INIT_ID(mapping), \
     INIT_ID(match), \
+    INIT_ID(max_items), \
     INIT_ID(max_length), \
     INIT_ID(maxdigits), \
     INIT_ID(maxevents), \
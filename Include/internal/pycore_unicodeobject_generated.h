@@ -382,6 +382,8 @@ _PyUnicode_InitStaticStrings(void) {
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(_is_text_encoding);
     PyUnicode_InternInPlace(&string);
+    string = &_Py_ID(_isatty_open_only);
+    PyUnicode_InternInPlace(&string);
     string = &_Py_ID(_length_);
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(_lock_unlock_module);
@@ -466,6 +468,8 @@ _PyUnicode_InitStaticStrings(void) {
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(buffer_size);
     PyUnicode_InternInPlace(&string);
+    string = &_Py_ID(buffer_threshold);
+    PyUnicode_InternInPlace(&string);
     string = &_Py_ID(buffering);
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(buffers);
@@ -638,6 +642,8 @@ _PyUnicode_InitStaticStrings(void) {
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(e);
     PyUnicode_InternInPlace(&string);
+    string = &_Py_ID(eager_start);
+    PyUnicode_InternInPlace(&string);
     string = &_Py_ID(effective_ids);
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(element_factory);
@@ -816,6 +822,8 @@ _PyUnicode_InitStaticStrings(void) {
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(intersection);
     PyUnicode_InternInPlace(&string);
+    string = &_Py_ID(is_running);
+    PyUnicode_InternInPlace(&string);
     string = &_Py_ID(isatty);
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(isinstance);
@@ -904,6 +912,8 @@ _PyUnicode_InitStaticStrings(void) {
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(match);
     PyUnicode_InternInPlace(&string);
+    string = &_Py_ID(max_items);
+    PyUnicode_InternInPlace(&string);
     string = &_Py_ID(max_length);
     PyUnicode_InternInPlace(&string);
     string = &_Py_ID(maxdigits);
@@ -26,6 +26,9 @@
 # open() uses st_blksize whenever we can
 DEFAULT_BUFFER_SIZE = 8 * 1024  # bytes
 
+# FileIO.readall() trusts the size found at open for files smaller than this
+_SMALL_FILE_SIZE = 64 * 1024  # bytes
+
 # NOTE: Base classes defined here are registered with the "official" ABCs
 # defined in io.py. We don't use real inheritance though, because we don't want
 # to inherit the C implementations.
@@ -241,18 +244,11 @@ def open(file, mode="r", buffering=-1, encoding=None, errors=None,
     result = raw
     try:
         line_buffering = False
-        if buffering == 1 or buffering < 0 and raw.isatty():
+        if buffering == 1 or buffering < 0 and raw._isatty_open_only():
             buffering = -1
             line_buffering = True
         if buffering < 0:
-            buffering = DEFAULT_BUFFER_SIZE
-            try:
-                bs = os.fstat(raw.fileno()).st_blksize
-            except (OSError, AttributeError):
-                pass
-            else:
-                if bs > 1:
-                    buffering = bs
+            buffering = raw._blksize
         if buffering < 0:
             raise ValueError("invalid buffering size")
         if buffering == 0:
@@ -1481,6 +1477,8 @@ class FileIO(RawIOBase):
     _writable = False
     _appending = False
     _seekable = None
+    _regular = False
+    _estimated_size = -1
     _closefd = True
 
     def __init__(self, file, mode='r', closefd=True, opener=None):
@@ -1583,6 +1581,9 @@ def __init__(self, file, mode='r', closefd=True, opener=None):
             self._blksize = getattr(fdfstat, 'st_blksize', 0)
             if self._blksize <= 1:
                 self._blksize = DEFAULT_BUFFER_SIZE
+            if stat.S_ISREG(fdfstat.st_mode):
+                self._regular = True
+                self._estimated_size = fdfstat.st_size
 
             if _setmode:
                 # don't translate newlines (\r\n <=> \n)
@@ -1661,13 +1662,20 @@ def readall(self):
         self._checkClosed()
         self._checkReadable()
         bufsize = DEFAULT_BUFFER_SIZE
-        try:
-            pos = os.lseek(self._fd, 0, SEEK_CUR)
-            end = os.fstat(self._fd).st_size
-            if end >= pos:
-                bufsize = end - pos + 1
-        except OSError:
-            pass
+        end = self._estimated_size
+        if 0 < end < _SMALL_FILE_SIZE:
+            # Trust the size found at open for small files rather than
+            # paying for lseek() and fstat().
+            bufsize = end + 1
+        else:
+            try:
+                pos = os.lseek(self._fd, 0, SEEK_CUR)
+                if end <= 0:
+                    end = os.fstat(self._fd).st_size
+                if end >= pos:
+                    bufsize = end - pos + 1
+            except OSError:
+                pass
 
         result = bytearray()
         while True:
@@ -1704,6 +1712,7 @@ def write(self, b):
         """
         self._checkClosed()
         self._checkWritable()
+        self._estimated_size = -1
         try:
             return os.write(self._fd, b)
         except BlockingIOError:
@@ -1740,6 +1749,7 @@ def truncate(self, size=None):
         """
         self._checkClosed()
         self._checkWritable()
+        self._estimated_size = -1
         if size is None:
             size = self.tell()
         os.ftruncate(self._fd, size)
@@ -1790,6 +1800,16 @@ def isatty(self):
         self._checkClosed()
         return os.isatty(self._fd)
 
+    def _isatty_open_only(self):
+        """Checks whether the file is a TTY using an open-only optimization.
+
+        A file which was a regular file when opened cannot be a TTY.
+        Only valid right after the file was opened.
+        """
+        if self._regular:
+            return False
+        return self.isatty()
+
     @property
     def closefd(self):
         """True if the file descriptor will be closed by close()."""
@@ -21,6 +21,9 @@
 
 _DEFAULT_LIMIT = 2 ** 16  # 64 KiB
 
+# Chunks up to this size are copied out of the read buffer by slicing.
+_SMALL_CHUNK_SIZE = 2048
+
 
 async def open_connection(host=None, port=None, *,
                           limit=_DEFAULT_LIMIT, **kwds):
@@ -464,6 +467,24 @@ def _maybe_resume_transport(self):
             self._paused = False
             self._transport.resume_reading()
 
+    def _consume(self, n):
+        """Remove and return the first n bytes of the buffer."""
+        buffer = self._buffer
+        if n >= len(buffer):
+            data = bytes(buffer)
+            buffer.clear()
+        else:
+            if n <= _SMALL_CHUNK_SIZE:
+                # Slicing copies the data twice, but is cheaper than going
+                # through a memoryview for short chunks such as lines.
+                data = bytes(buffer[:n])
+            else:
+                data = bytes(memoryview(buffer)[:n])
+            del buffer[:n]
+        if self._paused:
+            self._maybe_resume_transport()
+        return data
+
     def feed_eof(self):
         self._eof = True
         self._wakeup_waiter()
@@ -540,6 +561,10 @@ async def readline(self):
         """
         sep = b'\n'
         seplen = len(sep)
+        # Fast path: a complete line is already buffered.
+        isep = self._buffer.find(sep)
+        if 0 <= isep <= self._limit and self._exception is None:
+            return self._consume(isep + seplen)
         try:
             line = await self.readuntil(sep)
         except exceptions.IncompleteReadError as e:
@@ -639,10 +664,7 @@ async def readuntil(self, separator=b'\n'):
             raise exceptions.LimitOverrunError(
                 'Separator is found, but chunk is longer than limit', isep)
 
-        chunk = self._buffer[:isep + seplen]
-        del self._buffer[:isep + seplen]
-        self._maybe_resume_transport()
-        return bytes(chunk)
+        return self._consume(isep + seplen)
 
     async def read(self, n=-1):
         """Read up to `n` bytes from the stream.
@@ -688,11 +710,7 @@ async def read(self, n=-1):
             await self._wait_for_data('read')
 
         # This will work right even if buffer is less than n bytes
-        data = bytes(memoryview(self._buffer)[:n])
-        del self._buffer[:n]
-
-        self._maybe_resume_transport()
-        return data
+        return self._consume(n)
 
     async def readexactly(self, n):
         """Read exactly `n` bytes.
@@ -726,14 +744,7 @@ async def readexactly(self, n):
 
             await self._wait_for_data('readexactly')
 
-        if len(self._buffer) == n:
-            data = bytes(self._buffer)
-            self._buffer.clear()
-        else:
-            data = bytes(memoryview(self._buffer)[:n])
-            del self._buffer[:n]
-        self._maybe_resume_transport()
-        return data
+        return self._consume(n)
 
     def __aiter__(self):
         return self
@@ -6,6 +6,7 @@
     'wait', 'wait_for', 'as_completed', 'sleep',
     'gather', 'shield', 'ensure_future', 'run_coroutine_threadsafe',
     'current_task', 'all_tasks',
+    'create_eager_task_factory', 'eager_task_factory',
     '_register_task', '_unregister_task', '_enter_task', '_leave_task',
 )
 
@@ -48,6 +49,10 @@ def all_tasks(loop=None):
     # cast itself requires iteration, so we repeat it several times ignoring
     # RuntimeErrors (which are not very likely to occur). See issues 34970 and 36607 for
     # details.
+    #
+    # Eager tasks are captured first, so that a task which moves from
+    # _eager_tasks to _all_tasks in another thread is not missed.
+    eager_tasks = list(_eager_tasks)
     i = 0
     while True:
         try:
@@ -58,7 +63,7 @@ def all_tasks(loop=None):
                 raise
         else:
             break
-    return {t for t in tasks
+    return {t for t in itertools.chain(tasks, eager_tasks)
             if futures._get_loop(t) is loop and not t.done()}
 
 
@@ -93,7 +98,8 @@ class Task(futures._PyFuture):  # Inherit Python Task implementation
     # status is still pending
     _log_destroy_pending = True
 
-    def __init__(self, coro, *, loop=None, name=None, context=None):
+    def __init__(self, coro, *, loop=None, name=None, context=None,
+                 eager_start=False):
         super().__init__(loop=loop)
         if self._source_traceback:
             del self._source_traceback[-1]
@@ -117,8 +123,11 @@ def __init__(self, coro, *, loop=None, name=None, context=None):
         else:
             self._context = context
 
-        self._loop.call_soon(self.__step, context=self._context)
-        _register_task(self)
+        if eager_start and self._loop.is_running():
+            self.__eager_start()
+        else:
+            self._loop.call_soon(self.__step, context=self._context)
+            _register_task(self)
 
     def __del__(self):
         if self._state == futures._PENDING and self._log_destroy_pending:
@@ -250,6 +259,25 @@ def uncancel(self):
             self._num_cancels_requested -= 1
         return self._num_cancels_requested
 
+    def __eager_start(self):
+        prev_task = _swap_current_task(self._loop, self)
+        try:
+            _register_eager_task(self)
+            try:
+                self._context.run(self.__step_run_and_handle_result, None)
+            finally:
+                _unregister_eager_task(self)
+        finally:
+            try:
+                curtask = _swap_current_task(self._loop, prev_task)
+                assert curtask is self
+            finally:
+                if self.done():
+                    self._coro = None
+                    self = None  # Needed to break cycles when an exception occurs.
+                else:
+                    _register_task(self)
+
     def __step(self, exc=None):
         if self.done():
             raise exceptions.InvalidStateError(
@@ -258,10 +286,17 @@ def __step(self, exc=None):
             if not isinstance(exc, exceptions.CancelledError):
                 exc = self._make_cancelled_error()
             self._must_cancel = False
-        coro = self._coro
         self._fut_waiter = None
 
         _enter_task(self._loop, self)
+        try:
+            self.__step_run_and_handle_result(exc)
+        finally:
+            _leave_task(self._loop, self)
+            self = None  # Needed to break cycles when an exception occurs.
+
+    def __step_run_and_handle_result(self, exc):
+        coro = self._coro
         # Call either coro.throw(exc) or coro.send(None).
         try:
             if exc is None:
@@ -334,7 +369,6 @@ def __step(self, exc=None):
                 self._loop.call_soon(
                     self.__step, new_exc, context=self._context)
         finally:
-            _leave_task(self._loop, self)
             self = None  # Needed to break cycles when an exception occurs.
 
     def __wakeup(self, future):
@@ -382,6 +416,26 @@ def create_task(coro, *, name=None, context=None):
     return task
 
 
+def create_eager_task_factory(custom_task_constructor):
+    """Create a task factory that starts tasks eagerly.
+
+    The returned factory, suitable for loop.set_task_factory(), creates
+    tasks with custom_task_constructor (Task or a compatible class) and
+    runs their coroutine synchronously until it first suspends.  A
+    coroutine which completes without suspending never gets scheduled
+    on the event loop.
+    """
+
+    def factory(loop, coro, *, context=None):
+        return custom_task_constructor(
+            coro, loop=loop, context=context, eager_start=True)
+
+    return factory
+
+
+eager_task_factory = create_eager_task_factory(Task)
+
+
 # wait() and as_completed() similar to those in PEP 3148.
 
 FIRST_COMPLETED = concurrent.futures.FIRST_COMPLETED
@@ -933,6 +987,10 @@ def callback():
 # WeakSet containing all alive tasks.
 _all_tasks = weakref.WeakSet()
 
+# Set of tasks which are running their first step eagerly.  They are
+# moved to _all_tasks if they suspend.
+_eager_tasks = set()
+
 # Dictionary containing tasks that are currently active in
 # all running event loops.  {EventLoop: Task}
 _current_tasks = {}
@@ -959,21 +1017,45 @@ def _leave_task(loop, task):
     del _current_tasks[loop]
 
 
+def _swap_current_task(loop, task):
+    prev_task = _current_tasks.get(loop)
+    if task is None:
+        if prev_task is not None:
+            del _current_tasks[loop]
+    else:
+        _current_tasks[loop] = task
+    return prev_task
+
+
 def _unregister_task(task):
     """Unregister a task."""
     _all_tasks.discard(task)
 
 
+def _register_eager_task(task):
+    """Register a task which is running its first step eagerly."""
+    _eager_tasks.add(task)
+
+
+def _unregister_eager_task(task):
+    """Unregister a task which was running its first step eagerly."""
+    _eager_tasks.discard(task)
+
+
 _py_register_task = _register_task
 _py_unregister_task = _unregister_task
 _py_enter_task = _enter_task
 _py_leave_task = _leave_task
+_py_swap_current_task = _swap_current_task
+_py_register_eager_task = _register_eager_task
+_py_unregister_eager_task = _unregister_eager_task
 
 
 try:
     from _asyncio import (_register_task, _unregister_task,
-                          _enter_task, _leave_task,
-                          _all_tasks, _current_tasks)
+                          _enter_task, _leave_task, _swap_current_task,
+                          _register_eager_task, _unregister_eager_task,
+                          _all_tasks, _eager_tasks, _current_tasks)
 except ImportError:
     pass
 else:
@@ -981,3 +1063,6 @@ def _unregister_task(task):
     _c_unregister_task = _unregister_task
     _c_enter_task = _enter_task
     _c_leave_task = _leave_task
+    _c_swap_current_task = _swap_current_task
+    _c_register_eager_task = _register_eager_task
+    _c_unregister_eager_task = _unregister_eager_task
@@ -1,12 +1,14 @@
 """High-level support for working with threads in asyncio"""
 
+import concurrent.futures
 import functools
 import contextvars
+import os
 
 from . import events
 
 
-__all__ = "to_thread",
+__all__ = "to_thread", "FileIOExecutor"
 
 
 async def to_thread(func, /, *args, **kwargs):
@@ -23,3 +25,145 @@ async def to_thread(func, /, *args, **kwargs):
     ctx = contextvars.copy_context()
     func_call = functools.partial(ctx.run, func, *args, **kwargs)
     return await loop.run_in_executor(None, func_call)
+
+
+_PREAD = 'pread'
+_PWRITE = 'pwrite'
+_FSYNC = 'fsync'
+
+# Maximum number of writes merged into one os.pwritev() call
+try:
+    _MAX_MERGED_WRITES = max(os.sysconf('SC_IOV_MAX'), 16)
+except (AttributeError, ValueError, OSError):
+    _MAX_MERGED_WRITES = 16
+
+
+def _pwritev_all(fd, buffers, offset):
+    # Write all the buffers, continuing after short writes.
+    total = sum(len(buf) for buf in buffers)
+    written = os.pwritev(fd, buffers, offset)
+    while written < total:
+        skip = written
+        rest = []
+        for buf in buffers:
+            if skip >= len(buf):
+                skip -= len(buf)
+            else:
+                rest.append(buf[skip:])
+                skip = 0
+        buffers = rest
+        written += os.pwritev(fd, buffers, offset + written)
+
+
+class FileIOExecutor:
+    """Run positional reads and writes and fsyncs of files in a thread pool.
+
+    The operations requested during the same event loop iteration are
+    handed to the pool as one batch per file descriptor, run in order, and
+    their results are delivered with a single wakeup of the event loop.
+    Writes at contiguous offsets are merged into one os.pwritev() call,
+    and consecutive fsyncs of a file into one os.fsync() call.
+    """
+
+    def __init__(self, max_workers=None):
+        self._executor = concurrent.futures.ThreadPoolExecutor(
+            max_workers, thread_name_prefix='asyncio-fileio')
+        self._loop = None
+        self._pending = {}
+        self._shutdown = False
+
+    async def pread(self, fd, size, offset):
+        """Read at most *size* bytes from *fd* at *offset*."""
+        return await self._submit(fd, _PREAD, size, offset)
+
+    async def pwrite(self, fd, data, offset):
+        """Write the bytes-like object *data* to *fd* at *offset*.
+
+        Return the number of bytes written.
+        """
+        return await self._submit(fd, _PWRITE, memoryview(data).cast('B'),
+                                  offset)
+
+    async def fsync(self, fd):
+        """Force write of *fd* to disk."""
+        return await self._submit(fd, _FSYNC)
+
+    def shutdown(self, wait=True):
+        """Start the pending operations and release the thread pool.
+
+        If *wait* is true, wait for all the operations to complete.
+        """
+        self._shutdown = True
+        self._flush()
+        self._executor.shutdown(wait)
+
+    def _submit(self, fd, op, *args):
+        if self._shutdown:
+            raise RuntimeError('cannot schedule new operations after shutdown')
+        loop = events.get_running_loop()
+        if self._loop is None:
+            self._loop = loop
+        elif self._loop is not loop:
+            raise RuntimeError(f'{self!r} is bound to a different event loop')
+        future = loop.create_future()
+        if not self._pending:
+            loop.call_soon(self._flush)
+        self._pending.setdefault(fd, []).append((op, args, future))
+        return future
+
+    def _flush(self):
+        pending = self._pending
+        self._pending = {}
+        for fd, ops in pending.items():
+            self._executor.submit(self._run_batch, fd, ops)
+
+    def _run_batch(self, fd, ops):
+        # Run in a worker thread.
+        results = []
+        i = 0
+        while i < len(ops):
+            op, args, future = ops[i]
+            j = i + 1
+            try:
+                if op is _PWRITE:
+                    if hasattr(os, 'pwritev'):
+                        end = args[1] + len(args[0])
+                        while (j < len(ops) and ops[j][0] is _PWRITE and
+                               ops[j][1][1] == end and
+                               j - i < _MAX_MERGED_WRITES):
+                            end += len(ops[j][1][0])
+                            j += 1
+                    if j - i > 1:
+                        buffers = [ops[k][1][0] for k in range(i, j)]
+                        _pwritev_all(fd, buffers, args[1])
+                        values = [len(buf) for buf in buffers]
+                    else:
+                        values = [os.pwrite(fd, *args)]
+                elif op is _FSYNC:
+                    while j < len(ops) and ops[j][0] is _FSYNC:
+                        j += 1
+                    os.fsync(fd)
+                    values = [None] * (j - i)
+                else:
+                    values = [os.pread(fd, *args)]
+            except BaseException as exc:
+                results.extend((ops[k][2], exc, None) for k in range(i, j))
+            else:
+                results.extend((ops[k][2], None, value)
+                               for k, value in zip(range(i, j), values))
+            i = j
+        try:
+            self._loop.call_soon_threadsafe(self._deliver, results)
+        except RuntimeError:
+            # The event loop is closed.
+            pass
+
+    @staticmethod
+    def _deliver(results):
+        for future, exc, value in results:
+            if future.done():
+                continue
+            if exc is not None:
+                future.set_exception(exc)
+            else:
+                future.set_result(value)
@@ -4,6 +4,7 @@
 __author__ = 'Brian Quinlan (brian@sweetapp.com)'
 
 import collections
+import itertools
 import logging
 import threading
 import time
@@ -322,6 +323,40 @@ def _result_or_cancel(fut, timeout=None):
         del fut
 
 
+def _get_chunks(*iterables, chunksize):
+    """ Iterates over zip()ed iterables in chunks. """
+    it = zip(*iterables)
+    while True:
+        chunk = tuple(itertools.islice(it, chunksize))
+        if not chunk:
+            return
+        yield chunk
+
+
+def _process_chunk(fn, chunk):
+    """ Processes a chunk of an iterable passed to map.
+
+    Runs the function passed to map() on a chunk of the
+    iterable passed to map.
+
+    This function is run in a worker thread or process.
+
+    """
+    return [fn(*args) for args in chunk]
+
+
+def _chain_from_iterable_of_lists(iterable):
+    """
+    Specialized implementation of itertools.chain.from_iterable.
+    Each item in *iterable* should be a list.  This function is
+    careful not to keep references to yielded objects.
+    """
+    for element in iterable:
+        element.reverse()
+        while element:
+            yield element.pop()
+
+
 class Future(object):
     """Represents the result of an asynchronous computation."""
 
@@ -589,9 +624,8 @@ def map(self, fn, *iterables, timeout=None, chunksize=1):
             timeout: The maximum number of seconds to wait. If None, then there
                 is no limit on the wait time.
             chunksize: The size of the chunks the iterable will be broken into
-                before being passed to a child process. This argument is only
-                used by ProcessPoolExecutor; it is ignored by
-                ThreadPoolExecutor.
+                before being passed to a worker. This argument is only used
+                by ProcessPoolExecutor and ThreadPoolExecutor.
 
         Returns:
             An iterator equivalent to: map(func, *iterables) but the calls may
@@ -605,7 +639,7 @@ def map(self, fn, *iterables, timeout=None, chunksize=1):
         if timeout is not None:
             end_time = timeout + time.monotonic()
 
-        fs = [self.submit(fn, *args) for args in zip(*iterables)]
+        fs = self._submit_calls(fn, zip(*iterables))
 
         # Yield must be hidden in closure so that the futures are submitted
         # before the first iterator value is required.
@@ -624,6 +658,13 @@ def result_iterator():
                     future.cancel()
         return result_iterator()
 
+    def _submit_calls(self, fn, args_iterable):
+        """Submits fn(*args) for each tuple of args_iterable.
+
+        Used by map(), returns the list of futures.
+        """
+        return [self.submit(fn, *args) for args in args_iterable]
+
     def shutdown(self, wait=True, *, cancel_futures=False):
         """Clean-up the resources associated with the Executor.
 
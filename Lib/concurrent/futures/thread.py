@@ -6,6 +6,7 @@
 __author__ = 'Brian Quinlan (brian@sweetapp.com)'
 
 from concurrent.futures import _base
+from functools import partial
 import itertools
 import queue
 import threading
@@ -44,6 +45,8 @@ def _python_exit():
 
 
 class _WorkItem(object):
+    __slots__ = ('future', 'fn', 'args', 'kwargs')
+
     def __init__(self, future, fn, args, kwargs):
         self.future = future
         self.fn = fn
@@ -177,6 +180,44 @@ def submit(self, fn, /, *args, **kwargs):
             return f
     submit.__doc__ = _base.Executor.submit.__doc__
 
+    def _submit_calls(self, fn, args_iterable):
+        if type(self).submit is not ThreadPoolExecutor.submit:
+            # Honour an overridden submit()
+            return super()._submit_calls(fn, args_iterable)
+
+        # Queue all the calls at once, waking up the workers once rather
+        # than once per call.  Consume the iterable first: it runs
+        # arbitrary code, which must not run with the locks held.
+        kwargs = {}
+        work_items = [_WorkItem(_base.Future(), fn, args, kwargs)
+                      for args in args_iterable]
+        with self._shutdown_lock, _global_shutdown_lock:
+            if self._broken:
+                raise BrokenThreadPool(self._broken)
+
+            if self._shutdown:
+                raise RuntimeError('cannot schedule new futures after shutdown')
+            if _shutdown:
+                raise RuntimeError('cannot schedule new futures after '
+                                   'interpreter shutdown')
+
+            self._work_queue.put_many(work_items)
+            for _ in range(min(len(work_items), self._max_workers)):
+                self._adjust_thread_count()
+        return [w.future for w in work_items]
+
+    def map(self, fn, *iterables, timeout=None, chunksize=1):
+        if chunksize < 1:
+            raise ValueError("chunksize must be >= 1.")
+        if chunksize == 1:
+            return super().map(fn, *iterables, timeout=timeout)
+
+        results = super().map(partial(_base._process_chunk, fn),
+                              _base._get_chunks(*iterables, chunksize=chunksize),
+                              timeout=timeout)
+        return _base._chain_from_iterable_of_lists(results)
+    map.__doc__ = _base.Executor.map.__doc__
+
     def _adjust_thread_count(self):
         # if idle threads are available, don't spin new threads
         if self._idle_semaphore.acquire(timeout=0):
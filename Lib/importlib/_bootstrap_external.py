@@ -1604,12 +1604,128 @@ def find_distributions(*args, **kwargs):
         return MetadataPathFinder.find_distributions(*args, **kwargs)
 
 
+# Persistent index of directory listings ####################################
+
+# The contents of the directories searched by FileFinder, keyed by directory
+# path, along with their mtime when they were listed:
+# {path: (mtime, (name, ...))}.  It is stored in the file named by the
+# PYTHONIMPORTINDEX environment variable, so that processes using the same
+# file do not need to list the directories on their search path again.
+# None when not loaded yet, False when disabled.
+_path_index = None
+_path_index_filename = None
+# Entries added to the index since it was loaded, written to the file when
+# the interpreter exits.  None marks an entry to remove.
+_path_index_pending = {}
+# time.time(), imported when the index is enabled.
+_path_index_time = None
+# Directories modified less than this many seconds before being listed are
+# not indexed: with coarse mtimes, they could be modified again without
+# their mtime changing (the "racy" entries of git's index).
+_PATH_INDEX_RACY_DELAY = 2
+
+
+def _read_path_index(filename):
+    try:
+        with _io.FileIO(filename, 'r') as file:
+            data = file.read()
+    except OSError:
+        return {}
+    if data[:4] != MAGIC_NUMBER:
+        return {}
+    try:
+        index = marshal.loads(memoryview(data)[4:])
+    except (EOFError, ValueError, TypeError):
+        return {}
+    if type(index) is not dict:
+        return {}
+    for path, entry in index.items():
+        if (type(path) is not str or type(entry) is not tuple
+                or len(entry) != 2 or type(entry[0]) not in (int, float)
+                or type(entry[1]) is not tuple):
+            return {}
+    return index
+
+
+def _get_path_index():
+    global _path_index, _path_index_filename, _path_index_time
+    if _path_index is None:
+        _path_index = False
+        if sys.flags.ignore_environment:
+            return False
+        if sys.platform.startswith(_CASE_INSENSITIVE_PLATFORMS_STR_KEY):
+            filename = _os.environ.get('PYTHONIMPORTINDEX')
+        else:
+            filename = _os.environ.get(b'PYTHONIMPORTINDEX')
+            if filename is not None:
+                filename = filename.decode(sys.getfilesystemencoding(),
+                                           sys.getfilesystemencodeerrors())
+        if not filename:
+            return False
+        import atexit, time
+        atexit.register(_path_index_flush)
+        _path_index_time = time.time
+        _path_index = _read_path_index(filename)
+        _path_index_filename = _path_abspath(filename)
+    return _path_index
+
+
+def _path_index_lookup(path, mtime):
+    """Return the indexed contents of a directory or None if they are stale."""
+    index = _get_path_index()
+    if index:
+        entry = index.get(path)
+        if entry is not None and entry[0] == mtime:
+            _bootstrap._verbose_message('{} found in the import index', path,
+                                        verbosity=2)
+            return entry[1]
+    return None
+
+
+def _path_index_store(path, mtime, contents):
+    index = _get_path_index()
+    if index is False:
+        return
+    if mtime == -1 or mtime > _path_index_time() - _PATH_INDEX_RACY_DELAY:
+        # Forget the entry, which may have become stale.
+        if index.pop(path, None) is not None:
+            _path_index_pending[path] = None
+        return
+    entry = (mtime, tuple(contents))
+    index[path] = entry
+    _path_index_pending[path] = entry
+
+
+def _path_index_flush():
+    """Write the entries added to the index since the last flush."""
+    if not _path_index_pending:
+        return
+    # Other processes may have updated the file since it was read: merge
+    # their entries rather than overwriting them.
+    index = _read_path_index(_path_index_filename)
+    for path, entry in _path_index_pending.items():
+        if entry is None:
+            index.pop(path, None)
+        else:
+            index[path] = entry
+    _path_index_pending.clear()
+    try:
+        _write_atomic(_path_index_filename,
+                      MAGIC_NUMBER + marshal.dumps(index))
+    except OSError as exc:
+        _bootstrap._verbose_message('could not write the import index {!r}: {}',
+                                    _path_index_filename, exc)
+
+
 class FileFinder:
 
     """File-based finder.
 
     Interactions with the file system are cached for performance, being
     refreshed when the directory the finder is handling has been modified.
+    When the PYTHONIMPORTINDEX environment variable is set, the directory is
+    only checked for changes the first time it is searched, and listed again
+    after invalidate_caches() is called.
 
     """
 
@@ -1629,10 +1745,12 @@ def __init__(self, path, *loader_details):
         self._path_mtime = -1
         self._path_cache = set()
         self._relaxed_path_cache = set()
+        self._bypass_index = False
 
     def invalidate_caches(self):
-        """Invalidate the directory mtime."""
+        """Invalidate the directory mtime and its indexed listing."""
         self._path_mtime = -1
+        self._bypass_index = True
 
     find_module = _find_module_shim
 
@@ -1663,13 +1781,14 @@ def find_spec(self, fullname, target=None):
         """
         is_namespace = False
         tail_module = fullname.rpartition('.')[2]
-        try:
-            mtime = _path_stat(self.path or _os.getcwd()).st_mtime
-        except OSError:
-            mtime = -1
-        if mtime != self._path_mtime:
-            self._fill_cache()
-            self._path_mtime = mtime
+        if self._path_mtime == -1 or _get_path_index() is False:
+            try:
+                mtime = _path_stat(self.path or _os.getcwd()).st_mtime
+            except OSError:
+                mtime = -1
+            if mtime != self._path_mtime:
+                self._fill_cache(mtime)
+                self._path_mtime = mtime
         # tail_module keeps the original casing, for __file__ and friends
         if _relax_case():
             cache = self._relaxed_path_cache
@@ -1707,15 +1826,23 @@ def find_spec(self, fullname, target=None):
             return spec
         return None
 
-    def _fill_cache(self):
+    def _fill_cache(self, mtime=-1):
         """Fill the cache of potential modules and packages for this directory."""
         path = self.path
-        try:
-            contents = _os.listdir(path or _os.getcwd())
-        except (FileNotFoundError, PermissionError, NotADirectoryError):
-            # Directory has either been removed, turned into a file, or made
-            # unreadable.
-            contents = []
+        if self._bypass_index:
+            self._bypass_index = False
+            contents = None
+        else:
+            contents = _path_index_lookup(path, mtime)
+        if contents is None:
+            try:
+                contents = _os.listdir(path or _os.getcwd())
+            except (FileNotFoundError, PermissionError, NotADirectoryError):
+                # Directory has either been removed, turned into a file, or
+                # made unreadable.
+                contents = []
+                mtime = -1
+            _path_index_store(path, mtime, contents)
         # We store two cached versions, to handle runtime changes of the
         # PYTHONCASEOK environment variable.
         if not sys.platform.startswith('win'):
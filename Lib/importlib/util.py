@@ -4,6 +4,7 @@
 from ._bootstrap import _resolve_name
 from ._bootstrap import spec_from_loader
 from ._bootstrap import _find_spec
+from ._bootstrap import _ModuleLockManager
 from ._bootstrap_external import MAGIC_NUMBER
 from ._bootstrap_external import _RAW_MAGIC_NUMBER
 from ._bootstrap_external import cache_from_source
@@ -118,36 +119,58 @@ class _LazyModule(types.ModuleType):
 
     def __getattribute__(self, attr):
         """Trigger the load of the module and return the attribute."""
-        # All module metadata must be garnered from __spec__ in order to avoid
-        # using mutated values.
-        # Stop triggering this method.
-        self.__class__ = types.ModuleType
-        # Get the original name to make sure no object substitution occurred
-        # in sys.modules.
-        original_name = self.__spec__.name
-        # Figure out exactly what attributes were mutated between the creation
-        # of the module and now.
-        attrs_then = self.__spec__.loader_state['__dict__']
-        attrs_now = self.__dict__
-        attrs_updated = {}
-        for key, value in attrs_now.items():
-            # Code that set the attribute may have kept a reference to the
-            # assigned object, making identity more important than equality.
-            if key not in attrs_then:
-                attrs_updated[key] = value
-            elif id(attrs_now[key]) != id(attrs_then[key]):
-                attrs_updated[key] = value
-        self.__spec__.loader.exec_module(self)
-        # If exec_module() was used directly there is no guarantee the module
-        # object was put into sys.modules.
-        if original_name in sys.modules:
-            if id(self) != id(sys.modules[original_name]):
-                raise ValueError(f"module object for {original_name!r} "
-                                  "substituted in sys.modules during a lazy "
-                                  "load")
-        # Update after loading since that's what would happen in an eager
-        # loading situation.
-        self.__dict__.update(attrs_updated)
+        __spec__ = object.__getattribute__(self, '__spec__')
+        loader_state = __spec__.loader_state
+        # Take the same lock as an eager import of the module, so that
+        # concurrent circular loads raise _DeadlockError instead of hanging.
+        with _ModuleLockManager(__spec__.name):
+            # Only the first thread to get the lock triggers the load, the
+            # others wait for it and then get the attribute.
+            if object.__getattribute__(self, '__class__') is _LazyModule:
+                __class__ = loader_state['__class__']
+                # Reentrant calls from the same thread, e.g. by the module
+                # body itself, must not trigger the load again.
+                if loader_state['is_loading']:
+                    return __class__.__getattribute__(self, attr)
+                loader_state['is_loading'] = True
+                try:
+                    __dict__ = __class__.__getattribute__(self, '__dict__')
+                    # All module metadata must be garnered from __spec__ in
+                    # order to avoid using mutated values.
+                    # Get the original name to make sure no object substitution
+                    # occurred in sys.modules.
+                    original_name = __spec__.name
+                    # Figure out exactly what attributes were mutated between
+                    # the creation of the module and now.
+                    attrs_then = loader_state['__dict__']
+                    attrs_now = __dict__
+                    attrs_updated = {}
+                    for key, value in attrs_now.items():
+                        # Code that set the attribute may have kept a
+                        # reference to the assigned object, making identity
+                        # more important than equality.
+                        if key not in attrs_then:
+                            attrs_updated[key] = value
+                        elif id(attrs_now[key]) != id(attrs_then[key]):
+                            attrs_updated[key] = value
+                    __spec__.loader.exec_module(self)
+                    # If exec_module() was used directly there is no guarantee
+                    # the module object was put into sys.modules.
+                    if original_name in sys.modules:
+                        if id(self) != id(sys.modules[original_name]):
+                            raise ValueError(f"module object for "
+                                             f"{original_name!r} substituted "
+                                             "in sys.modules during a lazy "
+                                             "load")
+                    # Update after loading since that's what would happen in an
+                    # eager loading situation.
+                    __dict__.update(attrs_updated)
+                    # Stop triggering this method, unless the module changed
+                    # its own class.
+                    if isinstance(self, _LazyModule):
+                        object.__setattr__(self, '__class__', __class__)
+                finally:
+                    loader_state['is_loading'] = False
         return getattr(self, attr)
 
     def __delattr__(self, attr):
@@ -191,5 +214,56 @@ def exec_module(self, module):
         loader_state = {}
         loader_state['__dict__'] = module.__dict__.copy()
         loader_state['__class__'] = module.__class__
+        loader_state['is_loading'] = False
         module.__spec__.loader_state = loader_state
         module.__class__ = _LazyModule
+
+
+def _is_lazy_import_excluded(name, exclude):
+    while True:
+        if name in exclude:
+            return True
+        name, dot, _ = name.rpartition('.')
+        if not dot:
+            return False
+
+
+def _enable_lazy_imports(exclude=()):
+    """Make the modules found on sys.path load lazily.
+
+    Source and bytecode modules are wrapped in LazyLoader, so that their
+    code is only executed when one of their attributes is first accessed.
+    Extension modules, and the modules listed in *exclude* and their
+    submodules, are still loaded eagerly.  This is used by
+    ``-X lazy_imports``.
+    """
+    from ._bootstrap_external import (FileFinder, SourceFileLoader,
+                                      SourcelessFileLoader,
+                                      _get_supported_file_loaders)
+    exclude = frozenset(exclude)
+
+    def lazy(loader_class):
+        def factory(fullname, path):
+            loader = loader_class(fullname, path)
+            if _is_lazy_import_excluded(fullname, exclude):
+                return loader
+            return LazyLoader(loader)
+        return factory
+
+    loader_details = []
+    for loader_class, suffixes in _get_supported_file_loaders():
+        if loader_class in (SourceFileLoader, SourcelessFileLoader):
+            loader_class = lazy(loader_class)
+        loader_details.append((loader_class, suffixes))
+    path_hook = FileFinder.path_hook(*loader_details)
+    # Replace the hook installed by importlib._bootstrap_external._install().
+    for i, hook in enumerate(sys.path_hooks):
+        if getattr(hook, '__name__', None) == 'path_hook_for_FileFinder':
+            sys.path_hooks[i] = path_hook
+            break
+    else:
+        sys.path_hooks.append(path_hook)
+    # Drop the finders created by the previous hook.
+    for path, finder in list(sys.path_importer_cache.items()):
+        if isinstance(finder, FileFinder):
+            del sys.path_importer_cache[path]
@@ -5,7 +5,7 @@
 """
 
 
-__all__ = [ 'SharedMemory', 'ShareableList' ]
+__all__ = [ 'SharedMemory', 'ShareableList', 'ShareableChannel' ]
 
 
 from functools import partial
@@ -25,6 +25,9 @@
 
 from . import resource_tracker
 
+# Whether ShareableChannel is available
+_HAS_RING = _USE_POSIX and hasattr(_posixshmem, 'ring_put')
+
 _O_CREX = os.O_CREAT | os.O_EXCL
 
 # FreeBSD (and perhaps other BSDs) limit names to 14 characters.
@@ -532,3 +535,103 @@ def index(self, value):
             raise ValueError(f"{value!r} not in this container")
 
     __class_getitem__ = classmethod(types.GenericAlias)
+
+
+class ShareableChannel:
+    """Pattern for a pipe-like channel between processes, backed by a ring
+    buffer in a shared memory block.
+
+    Messages are copied directly into and out of the shared memory block,
+    without going through a pipe or a feeder thread.  Any number of
+    processes may send and receive on the same channel concurrently:
+    senders and receivers are each serialized by a lock kept in the shared
+    memory block.  Pickled objects are sent with pickle protocol 5, their
+    out-of-band buffers being copied into the channel as they are."""
+
+    # A message sent by send() is laid out as follows:
+    # - 8 bytes: number of out-of-band buffers (N) as a 64-bit integer
+    # - (N + 1) * 8 bytes: sizes of the pickle data and of each buffer
+    # - the pickle data, followed by the contents of each buffer
+    _default_size = 1024 * 1024
+
+    def __init__(self, size=None, *, name=None):
+        if not _HAS_RING:
+            raise NotImplementedError(
+                "ShareableChannel is not supported on this platform")
+        if name is None or size is not None:
+            if size is None:
+                size = self._default_size
+            if size <= 0:
+                raise ValueError("'size' must be a positive integer")
+            self.shm = SharedMemory(name, create=True,
+                                    size=_posixshmem.RING_HEADER_SIZE + size)
+            _posixshmem.ring_init(self.shm.buf)
+        else:
+            self.shm = SharedMemory(name)
+            # Check that the block actually holds a channel.
+            _posixshmem.ring_capacity(self.shm.buf)
+
+    def send_bytes(self, buf, timeout=None):
+        """Send the contents of a bytes-like object as a single message.
+
+        Block until there is enough free space in the channel, for at most
+        *timeout* seconds unless it is None."""
+        if not _posixshmem.ring_put(self.shm.buf, (buf,), timeout):
+            raise TimeoutError("timed out waiting for space in the channel")
+
+    def recv_bytes(self, timeout=None):
+        """Return the oldest message of the channel as bytes.
+
+        Block until a message is available, for at most *timeout* seconds
+        unless it is None."""
+        data = _posixshmem.ring_get(self.shm.buf, timeout)
+        if data is None:
+            raise TimeoutError("timed out waiting for a message")
+        return data
+
+    def send(self, obj, timeout=None):
+        "Send a picklable object, to be read back with recv()."
+        from .reduction import ForkingPickler
+        buffers = []
+        data = ForkingPickler.dumps(obj, 5, buffer_callback=buffers.append)
+        buffers = [buffer.raw() for buffer in buffers]
+        header = struct.pack(
+            "q" * (len(buffers) + 2),
+            len(buffers), len(data), *[buffer.nbytes for buffer in buffers]
+        )
+        if not _posixshmem.ring_put(self.shm.buf, [header, data, *buffers],
+                                    timeout):
+            raise TimeoutError("timed out waiting for space in the channel")
+
+    def recv(self, timeout=None):
+        """Receive an object sent with send().
+
+        Out-of-band buffers are returned as read-only views of the
+        received message."""
+        from .reduction import ForkingPickler
+        message = memoryview(self.recv_bytes(timeout))
+        nbuffers = struct.unpack_from("q", message)[0]
+        sizes = struct.unpack_from("q" * (nbuffers + 1), message, 8)
+        offset = (nbuffers + 2) * 8
+        chunks = []
+        for size in sizes:
+            chunks.append(message[offset:offset + size])
+            offset += size
+        return ForkingPickler.loads(chunks[0], buffers=chunks[1:])
+
+    def poll(self, timeout=0.0):
+        """Return whether there is any message available to be read.
+
+        Block for at most *timeout* seconds, or forever if it is None."""
+        return _posixshmem.ring_poll(self.shm.buf, timeout)
+
+    @property
+    def capacity(self):
+        "Size in bytes of the ring buffer holding the messages."
+        return _posixshmem.ring_capacity(self.shm.buf)
+
+    def __reduce__(self):
+        return partial(self.__class__, name=self.shm.name), ()
+
+    def __repr__(self):
+        return f'{self.__class__.__name__}(name={self.shm.name!r})'
@@ -31,6 +31,7 @@
 import sys
 from sys import maxsize
 from struct import pack, unpack
+import operator
 import re
 import io
 import codecs
@@ -407,7 +408,7 @@ def decode_long(data):
 class _Pickler:
 
     def __init__(self, file, protocol=None, *, fix_imports=True,
-                 buffer_callback=None):
+                 buffer_callback=None, buffer_threshold=None):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
@@ -440,6 +441,11 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
 
         It is an error if *buffer_callback* is not None and *protocol*
         is None or smaller than 5.
+
+        If *buffer_threshold* is not None, bytes, bytearray and contiguous
+        memoryview objects of at least that many bytes are passed to
+        *buffer_callback* as if they were wrapped in a PickleBuffer, so they
+        can be sent out-of-band too.  It requires a *buffer_callback*.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -450,6 +456,13 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
         if buffer_callback is not None and protocol < 5:
             raise ValueError("buffer_callback needs protocol >= 5")
         self._buffer_callback = buffer_callback
+        if buffer_threshold is not None:
+            if buffer_callback is None:
+                raise ValueError("buffer_threshold needs a buffer_callback")
+            buffer_threshold = operator.index(buffer_threshold)
+            if buffer_threshold < 0:
+                raise ValueError("buffer_threshold must be non-negative")
+        self._buffer_threshold = buffer_threshold
         try:
             self._file_write = file.write
         except AttributeError:
@@ -547,6 +560,11 @@ def save(self, obj, save_persistent_id=True):
             self.write(self.get(x[0]))
             return
 
+        if (self._buffer_threshold is not None and
+                type(obj) in (bytes, bytearray, memoryview) and
+                self.save_large_buffer(obj)):
+            return
+
         rv = NotImplemented
         reduce = getattr(self, "reducer_override", None)
         if reduce is not None:
@@ -821,6 +839,37 @@ def save_bytearray(self, obj):
         self.memoize(obj)
     dispatch[bytearray] = save_bytearray
 
+    def save_large_buffer(self, obj):
+        # Pickle a large bytes-like object as if it was wrapped in a
+        # PickleBuffer.  Return False if it should be pickled the usual
+        # way instead.
+        with memoryview(obj) as m:
+            if m.nbytes < self._buffer_threshold or not m.contiguous:
+                return False
+            if _HAVE_PICKLE_BUFFER:
+                buffer = PickleBuffer(obj)
+            else:
+                buffer = memoryview(obj)
+            if self._buffer_callback(buffer):
+                if type(obj) is not memoryview:
+                    return False
+                # Write data in-band, memoizing obj rather than the copy
+                data = m.tobytes()
+                if m.readonly:
+                    self.save_bytes(data)
+                else:
+                    self.save_bytearray(data)
+                x = self.memo.pop(id(data), None)
+                if x is not None:
+                    self.memo[id(obj)] = x[0], obj
+                return True
+            # Write data out-of-band
+            self.write(NEXT_BUFFER)
+            if m.readonly:
+                self.write(READONLY_BUFFER)
+            self.memoize(obj)
+            return True
+
     if _HAVE_PICKLE_BUFFER:
         def save_picklebuffer(self, obj):
             if self.proto < 5:
@@ -1747,14 +1796,18 @@ def load_stop(self):
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None,
+          buffer_threshold=None):
     _Pickler(file, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback,
+             buffer_threshold=buffer_threshold).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None,
+           buffer_threshold=None):
     f = io.BytesIO()
     _Pickler(f, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback,
+             buffer_threshold=buffer_threshold).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
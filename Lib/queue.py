@@ -4,6 +4,7 @@
 import types
 from collections import deque
 from heapq import heappush, heappop
+from operator import index
 from time import monotonic as time
 try:
     from _queue import SimpleQueue
@@ -295,6 +296,32 @@ def get(self, block=True, timeout=None):
             raise Empty
         return self._queue.popleft()
 
+    def put_many(self, items, /):
+        '''Put all the items of an iterable on the queue.
+
+        Waiting consumers are woken up once rather than once per item.
+        This method never blocks.
+        '''
+        items = list(items)
+        if items:
+            self._queue.extend(items)
+            self._count.release(len(items))
+
+    def get_many(self, max_items=None, block=True, timeout=None):
+        '''Remove and return a list of items from the queue.
+
+        Wait for an item like get(), then return it together with the other
+        items immediately available, oldest first.  At most 'max_items' items
+        are returned; all the available items if it is None or negative.
+        '''
+        max_items = -1 if max_items is None else index(max_items)
+        if max_items == 0:
+            return []
+        items = [self.get(block, timeout)]
+        while len(items) != max_items and self._count.acquire(False):
+            items.append(self._queue.popleft())
+        return items
+
     def put_nowait(self, item):
         '''Put an item into the queue without blocking.
 
@@ -325,6 +325,7 @@ def select(self, timeout=None):
             return ready
         r = set(r)
         w = set(w)
+        fd_to_key = self._fd_to_key
         for fd in r | w:
             events = 0
             if fd in r:
@@ -332,7 +333,7 @@ def select(self, timeout=None):
             if fd in w:
                 events |= EVENT_WRITE
 
-            key = self._key_from_fd(fd)
+            key = fd_to_key.get(fd)
             if key:
                 ready.append((key, events & key.events))
         return ready
@@ -415,15 +416,14 @@ def select(self, timeout=None):
             fd_event_list = self._selector.poll(timeout)
         except InterruptedError:
             return ready
+        fd_to_key = self._fd_to_key
+        not_read = ~self._EVENT_READ
+        not_write = ~self._EVENT_WRITE
         for fd, event in fd_event_list:
-            events = 0
-            if event & ~self._EVENT_READ:
-                events |= EVENT_WRITE
-            if event & ~self._EVENT_WRITE:
-                events |= EVENT_READ
-
-            key = self._key_from_fd(fd)
+            key = fd_to_key.get(fd)
             if key:
+                events = ((event & not_read and EVENT_WRITE)
+                          | (event & not_write and EVENT_READ))
                 ready.append((key, events & key.events))
         return ready
 
@@ -461,22 +461,21 @@ def select(self, timeout=None):
             # epoll_wait() expects `maxevents` to be greater than zero;
             # we want to make sure that `select()` can be called when no
             # FD is registered.
-            max_ev = max(len(self._fd_to_key), 1)
+            max_ev = len(self._fd_to_key) or 1
 
             ready = []
             try:
                 fd_event_list = self._selector.poll(timeout, max_ev)
             except InterruptedError:
                 return ready
+            fd_to_key = self._fd_to_key
+            not_read = ~select.EPOLLIN
+            not_write = ~select.EPOLLOUT
             for fd, event in fd_event_list:
-                events = 0
-                if event & ~select.EPOLLIN:
-                    events |= EVENT_WRITE
-                if event & ~select.EPOLLOUT:
-                    events |= EVENT_READ
-
-                key = self._key_from_fd(fd)
+                key = fd_to_key.get(fd)
                 if key:
+                    events = ((event & not_read and EVENT_WRITE)
+                              | (event & not_write and EVENT_READ))
                     ready.append((key, events & key.events))
             return ready
 
@@ -555,12 +554,13 @@ def select(self, timeout=None):
             # If max_ev is 0, kqueue will ignore the timeout. For consistent
             # behavior with the other selector classes, we prevent that here
             # (using max). See https://bugs.python.org/issue29255
-            max_ev = max(len(self._fd_to_key), 1)
+            max_ev = len(self._fd_to_key) or 1
             ready = []
             try:
                 kev_list = self._selector.control(None, max_ev, timeout)
             except InterruptedError:
                 return ready
+            fd_to_key = self._fd_to_key
             for kev in kev_list:
                 fd = kev.ident
                 flag = kev.filter
@@ -570,7 +570,7 @@ def select(self, timeout=None):
                 if flag == select.KQ_FILTER_WRITE:
                     events |= EVENT_WRITE
 
-                key = self._key_from_fd(fd)
+                key = fd_to_key.get(fd)
                 if key:
                     ready.append((key, events & key.events))
             return ready
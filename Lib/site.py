@@ -581,6 +581,18 @@ def execusercustomize():
                 (err.__class__.__name__, err))
 
 
+def enablelazyimports():
+    """Make the modules imported from now on load lazily.
+
+    The value of -X lazy_imports lists the modules which must still be
+    loaded eagerly.
+    """
+    value = sys._xoptions['lazy_imports']
+    exclude = value.split(',') if isinstance(value, str) else ()
+    import importlib.util
+    importlib.util._enable_lazy_imports(exclude)
+
+
 def main():
     """Add standard site-specific directories to the module search path.
 
@@ -609,6 +621,8 @@ def main():
     execsitecustomize()
     if ENABLE_USER_SITE:
         execusercustomize()
+    if 'lazy_imports' in sys._xoptions:
+        enablelazyimports()
 
 # Prevent extending of sys.path when python was started with -S and
 # site is imported later.
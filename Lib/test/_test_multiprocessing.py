@@ -4299,6 +4299,173 @@ def test_shared_memory_ShareableList_pickling_dead_object(self):
                 with self.assertRaises(FileNotFoundError):
                     pickle.loads(serialized_sl)
 
+    def test_shared_memory_ShareableChannel_basics(self):
+        chan = shared_memory.ShareableChannel(256)
+        self.addCleanup(chan.shm.unlink)
+        self.addCleanup(chan.shm.close)
+        self.assertEqual(chan.capacity, 256)
+        self.assertIn(chan.shm.name, repr(chan))
+
+        self.assertFalse(chan.poll())
+        chan.send_bytes(b'spam')
+        chan.send_bytes(bytearray(b''))
+        chan.send_bytes(memoryview(b'eggs'))
+        self.assertTrue(chan.poll())
+        self.assertEqual(chan.recv_bytes(), b'spam')
+        self.assertEqual(chan.recv_bytes(), b'')
+        self.assertEqual(chan.recv_bytes(), b'eggs')
+        self.assertFalse(chan.poll(0.01))
+
+        # Messages wrap around the end of the ring buffer.
+        for i in range(1000):
+            message = bytes(range(i % 200))
+            chan.send_bytes(message)
+            self.assertEqual(chan.recv_bytes(), message)
+
+        with self.assertRaises(TimeoutError):
+            chan.recv_bytes(timeout=0.01)
+        with self.assertRaises(ValueError):
+            chan.send_bytes(b'x' * 256)
+        chan.send_bytes(b'x' * 200)
+        with self.assertRaises(TimeoutError):
+            chan.send_bytes(b'x' * 100, timeout=0.01)
+        self.assertEqual(chan.recv_bytes(), b'x' * 200)
+        with self.assertRaises(ValueError):
+            chan.recv_bytes(timeout=-1)
+
+        with self.assertRaises(ValueError):
+            shared_memory.ShareableChannel(0)
+        sms = shared_memory.SharedMemory(create=True, size=512)
+        self.addCleanup(sms.unlink)
+        self.addCleanup(sms.close)
+        with self.assertRaises(ValueError):
+            shared_memory.ShareableChannel(name=sms.name)
+
+    def test_shared_memory_ShareableChannel_objects(self):
+        chan = shared_memory.ShareableChannel(4096)
+        self.addCleanup(chan.shm.unlink)
+        self.addCleanup(chan.shm.close)
+
+        for obj in [None, 42, 'spam', [1, (2, 3)], {'x': b'\x00' * 1000}]:
+            chan.send(obj)
+            self.assertEqual(chan.recv(), obj)
+
+        data = bytearray(range(256))
+        chan.send([pickle.PickleBuffer(data), pickle.PickleBuffer(b''), 'tail'])
+        first, second, tail = chan.recv()
+        self.assertEqual(bytes(first), bytes(data))
+        self.assertEqual(bytes(second), b'')
+        self.assertEqual(tail, 'tail')
+
+    def test_shared_memory_ShareableChannel_pickling(self):
+        chan = shared_memory.ShareableChannel(1024)
+        self.addCleanup(chan.shm.unlink)
+        self.addCleanup(chan.shm.close)
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                other = pickle.loads(pickle.dumps(chan, protocol=proto))
+                self.assertIsInstance(other, shared_memory.ShareableChannel)
+                self.assertEqual(other.capacity, chan.capacity)
+                chan.send_bytes(b'ping')
+                self.assertEqual(other.recv_bytes(), b'ping')
+                other.send(proto)
+                self.assertEqual(chan.recv(), proto)
+                other.shm.close()
+
+    @classmethod
+    def _channel_echo(cls, inbox, outbox, count):
+        for _ in range(count):
+            outbox.send(inbox.recv())
+        inbox.shm.close()
+        outbox.shm.close()
+
+    @classmethod
+    def _channel_send_range(cls, chan, start, stop):
+        for i in range(start, stop):
+            chan.send(i)
+        chan.shm.close()
+
+    def test_shared_memory_ShareableChannel_across_processes(self):
+        # The channels are smaller than the data sent through them, so
+        # that both ends have to wait for each other.
+        inbox = shared_memory.ShareableChannel(1024)
+        self.addCleanup(inbox.shm.unlink)
+        self.addCleanup(inbox.shm.close)
+        outbox = shared_memory.ShareableChannel(1024)
+        self.addCleanup(outbox.shm.unlink)
+        self.addCleanup(outbox.shm.close)
+
+        count = 200
+        p = self.Process(target=self._channel_echo,
+                         args=(inbox, outbox, count))
+        p.daemon = True
+        p.start()
+        messages = [bytes([i]) * (i % 5 * 100) for i in range(count)]
+        received = []
+        for message in messages:
+            inbox.send(message)
+            while outbox.poll():
+                received.append(outbox.recv())
+        while len(received) < count:
+            received.append(outbox.recv(timeout=support.SHORT_TIMEOUT))
+        join_process(p)
+        self.assertEqual(received, messages)
+
+        # Several senders share the same channel.
+        procs = [self.Process(target=self._channel_send_range,
+                              args=(inbox, i * count, (i + 1) * count))
+                 for i in range(3)]
+        for p in procs:
+            p.daemon = True
+            p.start()
+        received = [inbox.recv(timeout=support.SHORT_TIMEOUT)
+                    for _ in range(3 * count)]
+        for p in procs:
+            join_process(p)
+        self.assertEqual(sorted(received), list(range(3 * count)))
+        for i in range(3):
+            sent = [x for x in received if i * count <= x < (i + 1) * count]
+            self.assertEqual(sent, sorted(sent))
+
+    @classmethod
+    def _channel_send_bytes(cls, chan, data):
+        chan.send_bytes(data)
+
+    @classmethod
+    def _channel_recv_bytes(cls, chan):
+        chan.recv_bytes()
+
+    def test_shared_memory_ShareableChannel_killed_owner(self):
+        # A process killed while holding the send or receive lock of a
+        # channel doesn't block the other processes forever.
+        chan = shared_memory.ShareableChannel(256)
+        self.addCleanup(chan.shm.unlink)
+        self.addCleanup(chan.shm.close)
+
+        def kill_lock_owner(target, args, lock_offset):
+            # lock_offset is the offset of the lock in the ring header.
+            p = self.Process(target=target, args=args)
+            p.daemon = True
+            p.start()
+            for _ in support.sleeping_retry(support.SHORT_TIMEOUT):
+                if struct.unpack_from('I', chan.shm.buf, lock_offset)[0]:
+                    break
+            p.kill()
+            join_process(p)
+
+        # The sender waits for space with the send lock held.
+        chan.send_bytes(b'x' * 200)
+        kill_lock_owner(self._channel_send_bytes, (chan, b'y' * 100), 72)
+        self.assertEqual(chan.recv_bytes(), b'x' * 200)
+        chan.send_bytes(b'spam', timeout=support.SHORT_TIMEOUT)
+        self.assertEqual(chan.recv_bytes(), b'spam')
+
+        # The receiver waits for data with the receive lock held.
+        kill_lock_owner(self._channel_recv_bytes, (chan,), 136)
+        chan.send_bytes(b'eggs')
+        self.assertEqual(chan.recv_bytes(timeout=support.SHORT_TIMEOUT),
+                         b'eggs')
+
     def test_shared_memory_cleaned_after_process_termination(self):
         cmd = '''if 1:
             import os, time, sys
@@ -2222,6 +2222,24 @@ def test_list_chunking(self):
             else:
                 self.assertTrue(num_appends >= 2)
 
+    def test_list_chunking_atoms(self):
+        # Runs of atoms interrupted by other objects, across batches
+        atoms = [None, True, False, 0, 1, -1, 255, 256, 65535, 65536,
+                 2**31 - 1, -2**31, 2**31, -2**31 - 1, 2**100, 0.0, -1.5,
+                 float('inf')]
+        s = 'abc'
+        x = (atoms * 50 + [s, (1, 2.0), s] + atoms * 100) * 3
+        for proto in protocols:
+            y = self.loads(self.dumps(x, proto))
+            self.assert_is_copy(x, y)
+            self.assertIs(y[900], y[902])
+        x = [1.5] * 2500
+        for proto in protocols:
+            s = self.dumps(x, proto)
+            self.assert_is_copy(x, self.loads(s))
+            if proto > 0:
+                self.assertEqual(count_opcode(pickle.APPENDS, s), 3)
+
     def test_dict_chunking(self):
         n = 10  # too small to chunk
         x = dict.fromkeys(range(n))
@@ -3008,6 +3026,79 @@ def test_inband_accept_default_buffers_argument(self):
             data_pickled = self.dumps(1, proto, buffer_callback=None)
             data = self.loads(data_pickled, buffers=None)
 
+    def test_buffer_threshold(self):
+        big = b"x" * 100
+        obj = [big, bytearray(b"y" * 100), memoryview(b"z" * 100),
+               b"small", big]
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            buffers = []
+            data = self.dumps(obj, proto, buffer_callback=buffers.append,
+                              buffer_threshold=100)
+            self.assertNotIn(b"x" * 100, data)
+            self.assertNotIn(b"y" * 100, data)
+            self.assertNotIn(b"z" * 100, data)
+            self.assertIn(b"small", data)
+            # The second reference to big is memoized
+            self.assertEqual([bytes(b) for b in buffers],
+                             [big, b"y" * 100, b"z" * 100])
+            with self.assertRaises(pickle.UnpicklingError):
+                self.loads(data)
+            new = self.loads(data, buffers=buffers)
+            self.assertEqual(len(new), 5)
+            for pb, expected in zip(new[:3], buffers):
+                self.assertIs(pb, expected)
+            self.assertEqual(new[3], b"small")
+            self.assertIs(new[4], new[0])
+            # Out-of-band data is reconstructed from the given memory
+            new = self.loads(data, buffers=map(memoryview, buffers))
+            self.assertEqual([type(x) for x in new],
+                             [memoryview] * 3 + [bytes, memoryview])
+            self.assertTrue(new[0].readonly)
+            self.assertFalse(new[1].readonly)
+            self.assertTrue(new[2].readonly)
+
+            # Buffers kept in-band keep their type, except memoryviews
+            data = self.dumps(obj, proto, buffer_callback=lambda pb: True,
+                              buffer_threshold=100)
+            new = self.loads(data)
+            self.assertEqual(new, [big, bytearray(b"y" * 100), b"z" * 100,
+                                   b"small", big])
+            self.assertEqual([type(x) for x in new],
+                             [bytes, bytearray, bytes, bytes, bytes])
+            self.assertIs(new[4], new[0])
+
+            # Memoryviews kept in-band are memoized
+            view = memoryview(b"w" * 100)
+            data = self.dumps([view, view], proto,
+                              buffer_callback=lambda pb: True,
+                              buffer_threshold=100)
+            self.assertEqual(data.count(b"w" * 100), 1)
+            new = self.loads(data)
+            self.assertEqual(new, [b"w" * 100] * 2)
+            self.assertIs(new[1], new[0])
+
+            # Below the threshold, memoryviews still cannot be pickled
+            with self.assertRaises(TypeError):
+                self.dumps(memoryview(b"small"), proto,
+                           buffer_callback=[].append, buffer_threshold=100)
+
+    def test_buffer_threshold_error(self):
+        for proto in range(0, pickle.HIGHEST_PROTOCOL + 1):
+            # buffer_threshold needs a buffer_callback
+            with self.assertRaises(ValueError):
+                self.dumps(b"foo", proto, buffer_threshold=0)
+        with self.assertRaises(ValueError):
+            self.dumps(b"foo", 5, buffer_callback=[].append,
+                       buffer_threshold=-1)
+        with self.assertRaises(TypeError):
+            self.dumps(b"foo", 5, buffer_callback=[].append,
+                       buffer_threshold=1.0)
+        def buffer_callback(buffers):
+            1/0
+        with self.assertRaises(ZeroDivisionError):
+            self.dumps(b"foo", 5, buffer_callback=buffer_callback,
+                       buffer_threshold=0)
+
     @unittest.skipIf(np is None, "Test needs Numpy")
     def test_buffers_numpy(self):
         def check_no_copy(x, y):
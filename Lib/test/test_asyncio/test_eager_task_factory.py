@@ -0,0 +1,217 @@
+"""Tests for eager task execution."""
+
+import asyncio
+import contextvars
+import unittest
+
+from asyncio import tasks
+
+
+def tearDownModule():
+    asyncio.set_event_loop_policy(None)
+
+
+class EagerTaskFactoryTestsMixin:
+
+    Task = None
+
+    async def asyncSetUp(self):
+        await super().asyncSetUp()
+        self.loop = asyncio.get_running_loop()
+        self.loop.set_task_factory(
+            asyncio.create_eager_task_factory(self.Task))
+
+    async def test_factory_creates_task(self):
+        async def coro():
+            return 1
+
+        task = asyncio.create_task(coro())
+        self.assertIsInstance(task, self.Task)
+        self.assertTrue(task.done())
+
+    async def test_completes_without_scheduling(self):
+        order = []
+
+        async def coro():
+            order.append('task')
+            return 42
+
+        self.loop.call_soon(order.append, 'callback')
+        task = asyncio.create_task(coro())
+        self.assertTrue(task.done())
+        self.assertEqual(task.result(), 42)
+        self.assertNotIn(task, asyncio.all_tasks())
+        self.assertIsNone(task.get_coro())
+        self.assertEqual(order, ['task'])
+        await asyncio.sleep(0)
+        self.assertEqual(order, ['task', 'callback'])
+
+    async def test_suspends(self):
+        order = []
+
+        async def coro():
+            order.append('start')
+            await asyncio.sleep(0)
+            order.append('end')
+            return 7
+
+        task = asyncio.create_task(coro())
+        self.assertEqual(order, ['start'])
+        self.assertFalse(task.done())
+        self.assertIn(task, asyncio.all_tasks())
+        self.assertEqual(await task, 7)
+        self.assertEqual(order, ['start', 'end'])
+
+    async def test_current_task(self):
+        outer = asyncio.current_task()
+
+        async def coro():
+            return asyncio.current_task()
+
+        task = asyncio.create_task(coro())
+        self.assertIs(task.result(), task)
+        self.assertIs(asyncio.current_task(), outer)
+
+    async def test_current_task_after_suspend(self):
+        outer = asyncio.current_task()
+        fut = self.loop.create_future()
+
+        async def coro():
+            await fut
+            return asyncio.current_task()
+
+        task = asyncio.create_task(coro())
+        self.assertIs(asyncio.current_task(), outer)
+        fut.set_result(None)
+        self.assertIs(await task, task)
+
+    async def test_exception(self):
+        async def coro():
+            raise ValueError('spam')
+
+        task = asyncio.create_task(coro())
+        self.assertTrue(task.done())
+        with self.assertRaisesRegex(ValueError, 'spam'):
+            await task
+
+    async def test_cancel_after_suspend(self):
+        async def coro():
+            await asyncio.sleep(10)
+
+        task = asyncio.create_task(coro())
+        self.assertFalse(task.done())
+        task.cancel()
+        with self.assertRaises(asyncio.CancelledError):
+            await task
+
+    async def test_name(self):
+        async def coro():
+            await asyncio.sleep(0)
+
+        task = asyncio.create_task(coro(), name='spam')
+        self.assertEqual(task.get_name(), 'spam')
+        await task
+
+    async def test_context(self):
+        cvar = contextvars.ContextVar('cvar', default='outer')
+
+        async def coro():
+            cvar.set('inner')
+            await asyncio.sleep(0)
+            return cvar.get()
+
+        task = asyncio.create_task(coro())
+        self.assertEqual(cvar.get(), 'outer')
+        self.assertEqual(await task, 'inner')
+        self.assertEqual(cvar.get(), 'outer')
+
+    async def test_explicit_context(self):
+        cvar = contextvars.ContextVar('cvar', default='outer')
+        ctx = contextvars.copy_context()
+        ctx.run(cvar.set, 'ctx')
+
+        async def coro():
+            return cvar.get()
+
+        task = asyncio.create_task(coro(), context=ctx)
+        self.assertEqual(task.result(), 'ctx')
+
+    async def test_gather(self):
+        async def sync():
+            return 1
+
+        async def suspend():
+            await asyncio.sleep(0)
+            return 2
+
+        self.assertEqual(await asyncio.gather(sync(), suspend(), sync()),
+                         [1, 2, 1])
+
+    async def test_taskgroup(self):
+        async def sync():
+            return 1
+
+        async def suspend():
+            await asyncio.sleep(0)
+            return 2
+
+        async with asyncio.TaskGroup() as tg:
+            t1 = tg.create_task(sync())
+            t2 = tg.create_task(suspend())
+            self.assertTrue(t1.done())
+        self.assertEqual((t1.result(), t2.result()), (1, 2))
+
+    async def test_taskgroup_eager_failure(self):
+        async def fail():
+            raise ValueError('spam')
+
+        async def forever():
+            await asyncio.sleep(10)
+
+        with self.assertRaises(ExceptionGroup) as cm:
+            async with asyncio.TaskGroup() as tg:
+                t = tg.create_task(forever())
+                tg.create_task(fail())
+        self.assertEqual(len(cm.exception.exceptions), 1)
+        self.assertIsInstance(cm.exception.exceptions[0], ValueError)
+        self.assertTrue(t.cancelled())
+
+    def test_not_running_loop(self):
+        loop = asyncio.new_event_loop()
+        self.addCleanup(loop.close)
+
+        async def coro():
+            return 1
+
+        task = self.Task(coro(), loop=loop, eager_start=True)
+        self.assertFalse(task.done())
+        self.assertEqual(loop.run_until_complete(task), 1)
+
+    async def test_subclass(self):
+        class MyTask(self.Task):
+            pass
+
+        self.loop.set_task_factory(asyncio.create_eager_task_factory(MyTask))
+
+        async def coro():
+            return 1
+
+        task = asyncio.create_task(coro())
+        self.assertIsInstance(task, MyTask)
+        self.assertTrue(task.done())
+
+
+class PyEagerTaskFactoryTests(EagerTaskFactoryTestsMixin,
+                              unittest.IsolatedAsyncioTestCase):
+    Task = tasks._PyTask
+
+
+@unittest.skipUnless(hasattr(tasks, '_CTask'),
+                     'requires the C _asyncio module')
+class CEagerTaskFactoryTests(EagerTaskFactoryTestsMixin,
+                             unittest.IsolatedAsyncioTestCase):
+    Task = getattr(tasks, '_CTask', None)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -744,6 +744,25 @@ def test_callbacks_remove_third_callback(self):
         self.assertEqual(bag, [42, 17])
         self.assertEqual(f.result(), 'foo')
 
+    def test_callbacks_order_after_remove(self):
+        bag = []
+        f = self._new_future()
+        cbs = [self._make_callback(bag, i) for i in range(6)]
+
+        for cb in cbs[:5]:
+            f.add_done_callback(cb)
+        self.assertEqual(f.remove_done_callback(cbs[1]), 1)
+        self.assertEqual(f.remove_done_callback(cbs[3]), 1)
+        f.add_done_callback(cbs[5])
+        f.add_done_callback(cbs[1])
+        self.assertEqual([cb for cb, ctx in f._callbacks],
+                         [cbs[0], cbs[2], cbs[4], cbs[5], cbs[1]])
+
+        f.set_result('foo')
+        self.run_briefly()
+
+        self.assertEqual(bag, [0, 2, 4, 5, 1])
+
     def test_callbacks_invoked_on_set_result(self):
         bag = []
         f = self._new_future()
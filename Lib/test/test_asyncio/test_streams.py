@@ -380,6 +380,68 @@ def test_readline_exception(self):
             ValueError, self.loop.run_until_complete, stream.readline())
         self.assertEqual(b'', stream._buffer)
 
+    def test_readline_exception_with_buffered_line(self):
+        # The exception is raised even if a complete line is buffered
+        stream = asyncio.StreamReader(loop=self.loop)
+        stream.feed_data(b'line1\nline2\n')
+        stream.set_exception(ValueError())
+
+        self.assertRaises(
+            ValueError, self.loop.run_until_complete, stream.readline())
+        self.assertEqual(b'line1\nline2\n', stream._buffer)
+
+    def test_readline_buffered_limit(self):
+        # Lines already in the buffer are checked against the limit
+        stream = asyncio.StreamReader(limit=4, loop=self.loop)
+        stream.feed_data(b'1234\n12345\nabc\n')
+
+        line = self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'1234\n', line)
+        self.assertEqual(b'12345\nabc\n', stream._buffer)
+
+        with self.assertRaises(ValueError):
+            self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'abc\n', stream._buffer)
+
+        line = self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'abc\n', line)
+        self.assertEqual(b'', stream._buffer)
+
+        # Long lines are copied out through a memoryview
+        data = bytes(range(256)).replace(b'\n', b'') * 20
+        stream = asyncio.StreamReader(limit=len(data), loop=self.loop)
+        stream.feed_data(data + b'\n' + data + b'x\nend\n')
+
+        line = self.loop.run_until_complete(stream.readline())
+        self.assertEqual(data + b'\n', line)
+        with self.assertRaises(ValueError):
+            self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'end\n', stream._buffer)
+
+    def test_readline_resumes_transport(self):
+        # Buffered lines drain the buffer and resume the paused transport
+        # once it is back to the limit
+        stream = asyncio.StreamReader(limit=4, loop=self.loop)
+        transport = mock.Mock()
+        stream.set_transport(transport)
+        stream.feed_data(b'1\n' * 5)
+        transport.pause_reading.assert_called_once_with()
+
+        for remaining in (8, 6):
+            line = self.loop.run_until_complete(stream.readline())
+            self.assertEqual(b'1\n', line)
+            self.assertEqual(remaining, len(stream._buffer))
+            transport.resume_reading.assert_not_called()
+
+        line = self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'1\n', line)
+        self.assertEqual(b'1\n1\n', stream._buffer)
+        transport.resume_reading.assert_called_once_with()
+
+        # Reading further doesn't resume the transport again
+        self.loop.run_until_complete(stream.readline())
+        transport.resume_reading.assert_called_once_with()
+
     def test_readuntil_separator(self):
         stream = asyncio.StreamReader(loop=self.loop)
         with self.assertRaisesRegex(ValueError, 'Separator should be'):
@@ -1,6 +1,8 @@
 """Tests for asyncio/threads.py"""
 
 import asyncio
+import os
+import tempfile
 import unittest
 
 from contextvars import ContextVar
@@ -60,5 +62,70 @@ def get_ctx():
         self.assertEqual(result, 'parrot')
 
 
+@unittest.skipUnless(hasattr(os, 'pread') and hasattr(os, 'pwrite'),
+                     'requires os.pread() and os.pwrite()')
+class FileIOExecutorTests(unittest.IsolatedAsyncioTestCase):
+    def setUp(self):
+        super().setUp()
+        file = tempfile.TemporaryFile()
+        self.addCleanup(file.close)
+        self.fd = file.fileno()
+        self.executor = asyncio.FileIOExecutor(max_workers=2)
+        self.addCleanup(self.executor.shutdown)
+
+    async def test_read_write(self):
+        ex = self.executor
+        self.assertEqual(await ex.pwrite(self.fd, b'spam and eggs', 0), 13)
+        self.assertEqual(await ex.pwrite(self.fd, bytearray(b'ham'), 9), 3)
+        self.assertIsNone(await ex.fsync(self.fd))
+        self.assertEqual(await ex.pread(self.fd, 100, 0), b'spam and hams')
+        self.assertEqual(await ex.pread(self.fd, 3, 5), b'and')
+        self.assertEqual(await ex.pread(self.fd, 3, 100), b'')
+
+    async def test_batch(self):
+        ex = self.executor
+        writes = [ex.pwrite(self.fd, bytes([i]) * 10, i * 10)
+                  for i in range(10)]
+        # Operations of a batch run in order
+        ops = writes + [ex.fsync(self.fd), ex.fsync(self.fd),
+                        ex.pread(self.fd, 100, 0)]
+        with mock.patch('os.pwritev', wraps=os.pwritev) as pwritev, \
+                mock.patch('os.fsync', wraps=os.fsync) as fsync:
+            results = await asyncio.gather(*ops)
+        self.assertEqual(results[:10], [10] * 10)
+        self.assertEqual(results[10:12], [None, None])
+        self.assertEqual(results[12],
+                         b''.join(bytes([i]) * 10 for i in range(10)))
+        if hasattr(os, 'pwritev'):
+            pwritev.assert_called_once()
+        fsync.assert_called_once_with(self.fd)
+
+    async def test_errors(self):
+        ex = self.executor
+        with self.assertRaises(OSError):
+            await ex.pread(-1, 10, 0)
+        # An error is reported to every operation of a merged write
+        results = await asyncio.gather(ex.pwrite(-1, b'a', 0),
+                                       ex.pwrite(-1, b'b', 1),
+                                       return_exceptions=True)
+        self.assertEqual([type(exc) for exc in results], [OSError] * 2)
+        # Other files of the batch are not affected
+        results = await asyncio.gather(ex.pwrite(-1, b'a', 0),
+                                       ex.pwrite(self.fd, b'b', 0),
+                                       return_exceptions=True)
+        self.assertIsInstance(results[0], OSError)
+        self.assertEqual(results[1], 1)
+
+    async def test_shutdown(self):
+        ex = self.executor
+        fut = asyncio.ensure_future(ex.pwrite(self.fd, b'spam', 0))
+        await asyncio.sleep(0)
+        ex.shutdown()
+        with self.assertRaises(RuntimeError):
+            await ex.pread(self.fd, 4, 0)
+        self.assertEqual(await fut, 4)
+        self.assertEqual(os.pread(self.fd, 4, 0), b'spam')
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -821,6 +821,22 @@ def test_map(self):
                 list(self.executor.map(pow, range(10), range(10), chunksize=3)),
                 list(map(pow, range(10), range(10))))
 
+    def test_map_chunksize(self):
+        def bad_map():
+            list(self.executor.map(pow, range(40), range(40), chunksize=-1))
+
+        ref = list(map(pow, range(40), range(40)))
+        self.assertEqual(
+            list(self.executor.map(pow, range(40), range(40), chunksize=6)),
+            ref)
+        self.assertEqual(
+            list(self.executor.map(pow, range(40), range(40), chunksize=50)),
+            ref)
+        self.assertEqual(
+            list(self.executor.map(pow, range(40), range(40), chunksize=40)),
+            ref)
+        self.assertRaises(ValueError, bad_map)
+
     def test_map_exception(self):
         i = self.executor.map(divmod, [1, 1, 1, 1], [2, 3, 0, 5])
         self.assertEqual(i.__next__(), (0, 1))
@@ -892,6 +908,35 @@ def record_finished(n):
         self.executor.shutdown(wait=True)
         self.assertCountEqual(finished, range(10))
 
+    def test_map_chunksize_exception(self):
+        i = self.executor.map(divmod, [1, 1, 1, 1, 1], [2, 3, 0, 5, 6],
+                              chunksize=2)
+        self.assertEqual(next(i), (0, 1))
+        self.assertEqual(next(i), (0, 1))
+        self.assertRaises(ZeroDivisionError, next, i)
+
+    def test_map_saturation(self):
+        executor = self.executor_type(4)
+        sem = threading.Semaphore(0)
+        results = executor.map(sem.acquire, [True] * 15 * executor._max_workers)
+        self.assertEqual(len(executor._threads), executor._max_workers)
+        for i in range(15 * executor._max_workers):
+            sem.release()
+        self.assertEqual(list(results), [True] * 15 * executor._max_workers)
+        executor.shutdown(wait=True)
+
+    def test_map_overridden_submit(self):
+        submitted = []
+        class Executor(self.executor_type):
+            def submit(self, fn, /, *args, **kwargs):
+                submitted.append(args)
+                return super().submit(fn, *args, **kwargs)
+
+        with Executor(2) as executor:
+            self.assertEqual(list(executor.map(pow, [2, 3], [4, 5])),
+                             [16, 243])
+        self.assertEqual(submitted, [(2, 4), (3, 5)])
+
     def test_default_workers(self):
         executor = self.executor_type()
         expected = min(32, (os.cpu_count() or 1) + 4)
@@ -980,22 +1025,6 @@ def test_killed_child(self):
         # Submitting other jobs fails as well.
         self.assertRaises(BrokenProcessPool, self.executor.submit, pow, 2, 8)
 
-    def test_map_chunksize(self):
-        def bad_map():
-            list(self.executor.map(pow, range(40), range(40), chunksize=-1))
-
-        ref = list(map(pow, range(40), range(40)))
-        self.assertEqual(
-            list(self.executor.map(pow, range(40), range(40), chunksize=6)),
-            ref)
-        self.assertEqual(
-            list(self.executor.map(pow, range(40), range(40), chunksize=50)),
-            ref)
-        self.assertEqual(
-            list(self.executor.map(pow, range(40), range(40), chunksize=40)),
-            ref)
-        self.assertRaises(ValueError, bad_map)
-
     @classmethod
     def _test_traceback(cls):
         raise RuntimeError(123) # some comment
@@ -12,7 +12,9 @@
 from test.support import (
     cpython_only, swap_attr, gc_collect, is_emscripten, is_wasi
 )
-from test.support.os_helper import (TESTFN, TESTFN_UNICODE, make_bad_fd)
+from test.support.os_helper import (
+    TESTFN, TESTFN_UNICODE, make_bad_fd, unlink
+)
 from test.support.warnings_helper import check_warnings
 from collections import UserList
 
@@ -548,6 +550,26 @@ def testAppend(self):
             except:
                 pass
 
+    def testReadallSizeChanged(self):
+        # readall() uses the size of the file at open as a hint, it must
+        # still return the whole file when it changed since then.
+        self.addCleanup(unlink, TESTFN)
+        for size in (10, 100_000):
+            data = bytes(range(256)) * (size // 256 + 1)
+            with open(TESTFN, 'wb') as f:
+                f.write(data[:size])
+            with self.FileIO(TESTFN, 'r') as f:
+                with open(TESTFN, 'ab') as g:
+                    g.write(data[size:])
+                self.assertEqual(f.readall(), data)
+            with self.FileIO(TESTFN, 'r') as f:
+                os.truncate(TESTFN, 5)
+                self.assertEqual(f.readall(), data[:5])
+            with self.FileIO(TESTFN, 'r+') as f:
+                f.write(b'x' * (size + 1000))
+                f.seek(3)
+                self.assertEqual(f.readall(), b'x' * (size + 997))
+
     def testInvalidInit(self):
         self.assertRaises(TypeError, self.FileIO, "1", 0, 0)
 
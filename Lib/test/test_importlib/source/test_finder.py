@@ -3,12 +3,17 @@
 machinery = util.import_importlib('importlib.machinery')
 
 import errno
+import marshal
 import os
 import py_compile
 import stat
 import sys
 import tempfile
+import textwrap
+from importlib.util import MAGIC_NUMBER
+from test.support import os_helper
 from test.support.import_helper import make_legacy_pyc
+from test.support.script_helper import assert_python_ok
 import unittest
 import warnings
 
@@ -222,5 +227,190 @@ def _find(self, finder, name, loader_only=False):
  ) = util.test_both(FinderTestsPEP302, machinery=machinery)
 
 
+class PathIndexTests(unittest.TestCase):
+
+    """Tests for the index of directory listings enabled by the
+    PYTHONIMPORTINDEX environment variable."""
+
+    def run_python(self, root, index, code, *args):
+        code = textwrap.dedent(f"""
+            import posix, sys
+            root = {root!r}
+            listed = []
+            def listdir(path, *, _listdir=posix.listdir):
+                listed.append(path)
+                return _listdir(path)
+            posix.listdir = listdir
+            sys.path.insert(0, root)
+            """) + textwrap.dedent(code)
+        # Don't write bytecode, it would modify the directory.
+        return assert_python_ok('-B', *args, '-c', code,
+                                PYTHONIMPORTINDEX=index)
+
+    def age(self, *paths):
+        # Directories modified just before being listed are not indexed.
+        for path in paths:
+            st = os.stat(path)
+            os.utime(path, (st.st_atime - 60, st.st_mtime - 60))
+
+    def test_index(self):
+        with util.create_modules('top_level') as mapping, \
+                os_helper.temp_dir() as tmp:
+            root = mapping['.root']
+            self.age(root)
+            index = os.path.join(tmp, 'index')
+            code = """
+                import top_level
+                print(root in listed)
+                """
+            rc, out, err = self.run_python(root, index, code)
+            self.assertEqual(out.strip(), b'True')
+            self.assertTrue(os.path.exists(index))
+            # The listing of the directory comes from the index.
+            rc, out, err = self.run_python(root, index, code)
+            self.assertEqual(out.strip(), b'False')
+            # ... unless the directory has changed.
+            os_helper.create_empty_file(os.path.join(root, 'other.py'))
+            self.age(root)
+            rc, out, err = self.run_python(root, index, code)
+            self.assertEqual(out.strip(), b'True')
+            # -E ignores the environment variable.
+            os.unlink(index)
+            rc, out, err = self.run_python(root, index, code, '-E')
+            self.assertEqual(out.strip(), b'True')
+            self.assertFalse(os.path.exists(index))
+
+    def test_invalidate_caches(self):
+        # The directories are checked for changes only once.
+        with util.create_modules('top_level') as mapping, \
+                os_helper.temp_dir() as tmp:
+            root = mapping['.root']
+            index = os.path.join(tmp, 'index')
+            code = """
+                import importlib, os
+                import top_level
+                with open(os.path.join(root, 'new_module.py'), 'w'):
+                    pass
+                try:
+                    import new_module
+                except ImportError:
+                    print('not found')
+                importlib.invalidate_caches()
+                import new_module
+                print('found')
+                """
+            rc, out, err = self.run_python(root, index, code)
+            self.assertEqual(out.split(), [b'not', b'found', b'found'])
+
+    def test_invalidate_caches_same_mtime(self):
+        # invalidate_caches() lists the directory again even if its mtime
+        # didn't change.
+        with util.create_modules('top_level') as mapping, \
+                os_helper.temp_dir() as tmp:
+            root = mapping['.root']
+            self.age(root)
+            index = os.path.join(tmp, 'index')
+            code = """
+                import importlib, os
+                import top_level
+                st = os.stat(root)
+                with open(os.path.join(root, 'new_module.py'), 'w'):
+                    pass
+                os.utime(root, ns=(st.st_atime_ns, st.st_mtime_ns))
+                importlib.invalidate_caches()
+                import new_module
+                print('found')
+                """
+            rc, out, err = self.run_python(root, index, code)
+            self.assertEqual(out.strip(), b'found')
+
+    def test_racy_listing(self):
+        # A directory listed right after being modified isn't indexed,
+        # since it could change again without its mtime changing.
+        with util.create_modules('top_level') as mapping, \
+                os_helper.temp_dir() as tmp:
+            root = mapping['.root']
+            index = os.path.join(tmp, 'index')
+            st = os.stat(root)
+            self.run_python(root, index, 'import top_level')
+            os_helper.create_empty_file(os.path.join(root, 'new_module.py'))
+            os.utime(root, ns=(st.st_atime_ns, st.st_mtime_ns))
+            rc, out, err = self.run_python(root, index, """
+                import new_module
+                print(root in listed)
+                """)
+            self.assertEqual(out.strip(), b'True')
+
+    def test_invalid_index(self):
+        with util.create_modules('top_level') as mapping, \
+                os_helper.temp_dir() as tmp:
+            root = mapping['.root']
+            index = os.path.join(tmp, 'index')
+            mtime = os.stat(root).st_mtime
+            for data in (b'', b'garbage', MAGIC_NUMBER + b'junk',
+                         MAGIC_NUMBER + marshal.dumps([root]),
+                         MAGIC_NUMBER + marshal.dumps({root: mtime}),
+                         MAGIC_NUMBER + marshal.dumps({root: (mtime,)}),
+                         MAGIC_NUMBER + marshal.dumps({root: (mtime, None)}),
+                         MAGIC_NUMBER + marshal.dumps({root: (None, ())}),
+                         MAGIC_NUMBER + marshal.dumps({1: (mtime, ())})):
+                with open(index, 'wb') as file:
+                    file.write(data)
+                self.run_python(root, index, 'import top_level')
+                with open(index, 'rb') as file:
+                    self.assertEqual(file.read(4), MAGIC_NUMBER)
+
+    def test_written_once(self):
+        # The index is written when the interpreter exits, not after each
+        # directory is listed.
+        with util.create_modules('top_level', 'pkg.__init__',
+                                 'pkg.sub') as mapping, \
+                os_helper.temp_dir() as tmp:
+            root = mapping['.root']
+            self.age(root, os.path.join(root, 'pkg'))
+            index = os.path.join(tmp, 'index')
+            code = """
+                from importlib import _bootstrap_external
+                writes = []
+                def write_atomic(path, data, *args,
+                                 _write=_bootstrap_external._write_atomic):
+                    writes.append(path)
+                    _write(path, data, *args)
+                _bootstrap_external._write_atomic = write_atomic
+                import top_level, pkg.sub
+                print(len(writes))
+                """
+            rc, out, err = self.run_python(root, index, code)
+            self.assertEqual(out.strip(), b'0')
+            self.assertTrue(os.path.exists(index))
+
+    def test_merge(self):
+        # Processes using the same index keep the entries of each other.
+        with util.create_modules('mod1') as mapping1, \
+                os_helper.temp_dir() as root2, \
+                os_helper.temp_dir() as tmp:
+            root1 = mapping1['.root']
+            with open(os.path.join(root2, 'mod2.py'), 'w'):
+                pass
+            self.age(root1, root2)
+            index = os.path.join(tmp, 'index')
+            # The second process starts before the first one exits.
+            code = """
+                import mod1, subprocess, sys, os
+                subprocess.run([sys.executable, '-B', '-c', 'import mod2'],
+                               env=dict(os.environ, PYTHONPATH={root2!r}),
+                               check=True)
+                """.format(root2=root2)
+            self.run_python(root1, index, code)
+            code = """
+                import mod1
+                sys.path.insert(0, {root2!r})
+                import mod2
+                print(root in listed, {root2!r} in listed)
+                """.format(root2=root2)
+            rc, out, err = self.run_python(root1, index, code)
+            self.assertEqual(out.split(), [b'False', b'False'])
+
+
 if __name__ == '__main__':
     unittest.main()
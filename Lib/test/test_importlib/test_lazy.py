@@ -1,10 +1,17 @@
 import importlib
 from importlib import abc
 from importlib import util
+import os
+import subprocess
 import sys
+import textwrap
+import threading
 import types
 import unittest
 
+from test import support
+from test.support import threading_helper
+from test.support.script_helper import assert_python_ok
 from test.test_importlib import util as test_util
 
 
@@ -40,6 +47,7 @@ class TestingImporter(abc.MetaPathFinder, abc.Loader):
     module_name = 'lazy_loader_test'
     mutated_name = 'changed'
     loaded = None
+    load_count = 0
     source_code = 'attr = 42; __name__ = {!r}'.format(mutated_name)
 
     def find_spec(self, name, path, target=None):
@@ -48,6 +56,7 @@ def find_spec(self, name, path, target=None):
         return util.spec_from_loader(name, util.LazyLoader(self))
 
     def exec_module(self, module):
+        self.load_count += 1
         exec(self.source_code, module.__dict__)
         self.loaded = module
 
@@ -59,8 +68,9 @@ def test_init(self):
             # Classes that don't define exec_module() trigger TypeError.
             util.LazyLoader(object)
 
-    def new_module(self, source_code=None):
-        loader = TestingImporter()
+    def new_module(self, source_code=None, loader=None):
+        if loader is None:
+            loader = TestingImporter()
         if source_code is not None:
             loader.source_code = source_code
         spec = util.spec_from_loader(TestingImporter.module_name,
@@ -140,6 +150,136 @@ def test_module_already_in_sys(self):
             # Force the load; just care that no exception is raised.
             module.__name__
 
+    @threading_helper.requires_working_threading()
+    def test_module_load_race(self):
+        with test_util.uncache(TestingImporter.module_name):
+            loader = TestingImporter()
+            # Give the other thread a chance to access the module while
+            # it is loading.
+            module = self.new_module('import time; time.sleep(0.1); attr = 42',
+                                     loader=loader)
+            self.assertEqual(loader.load_count, 0)
+
+            class RaisingThread(threading.Thread):
+                exc = None
+                def run(self):
+                    try:
+                        super().run()
+                    except Exception as exc:
+                        self.exc = exc
+
+            def access_module():
+                return module.attr
+
+            threads = []
+            for _ in range(2):
+                threads.append(thread := RaisingThread(target=access_module))
+                thread.start()
+            # Races could cause errors
+            for thread in threads:
+                thread.join()
+                self.assertIsNone(thread.exc)
+            # Or multiple load attempts
+            self.assertEqual(loader.load_count, 1)
+
+
+class LazyImportsTests(unittest.TestCase):
+
+    """Tests for -X lazy_imports."""
+
+    def run_python(self, code, option='lazy_imports'):
+        with test_util.create_modules('eager', 'lazy', 'pkg.__init__',
+                                      'pkg.sub') as mapping:
+            for name, path in mapping.items():
+                if name != '.root':
+                    with open(path, 'w', encoding='utf-8') as file:
+                        file.write(f'import sys\n'
+                                   f'sys.executed.append({name!r})\n'
+                                   f'attr = {name!r}\n')
+            code = textwrap.dedent(f"""
+                import sys
+                sys.executed = []
+                sys.path.insert(0, {mapping['.root']!r})
+                """) + textwrap.dedent(code)
+            rc, out, err = assert_python_ok('-B', '-X', option, '-c', code)
+            return out.decode().split()
+
+    def test_lazy(self):
+        out = self.run_python("""
+            import lazy
+            print(sys.executed)
+            print(lazy.attr)
+            print(sys.executed)
+            """)
+        self.assertEqual(out, ['[]', 'lazy', "['lazy']"])
+
+    def test_exclude(self):
+        out = self.run_python("""
+            import eager, lazy, pkg.sub
+            print(','.join(sys.executed))
+            """, 'lazy_imports=eager,pkg')
+        self.assertEqual(out, ['eager,pkg.__init__,pkg.sub'])
+
+    def test_submodule(self):
+        # Importing a submodule needs the parent's __path__.
+        out = self.run_python("""
+            import pkg.sub
+            print(','.join(sys.executed))
+            from pkg import sub
+            print(sub.attr, ','.join(sys.executed))
+            """)
+        self.assertEqual(out, ['pkg.__init__', 'pkg.sub',
+                               'pkg.__init__,pkg.sub'])
+
+    @threading_helper.requires_working_threading()
+    def test_circular_load_in_threads(self):
+        # Two threads loading modules which use each other must not hang:
+        # like eager imports, one of them may get a _DeadlockError instead.
+        sources = {
+            'cycle1': 'X = "x"; sys.rendezvous(); import cycle2; Y = cycle2.Y',
+            'cycle2': 'Y = "y"; sys.rendezvous(); import cycle1; X = cycle1.X',
+        }
+        with test_util.create_modules(*sources) as mapping:
+            for name, source in sources.items():
+                with open(mapping[name], 'w', encoding='utf-8') as file:
+                    file.write('import sys\n' + source)
+            code = textwrap.dedent(f"""
+                import sys, threading
+                sys.path.insert(0, {mapping['.root']!r})
+                # Make both threads start loading before either of them
+                # accesses the other module.
+                barrier = threading.Barrier(2)
+                def rendezvous(calls=[]):
+                    calls.append(None)
+                    if len(calls) <= 2:
+                        barrier.wait({support.SHORT_TIMEOUT})
+                sys.rendezvous = rendezvous
+                import cycle1, cycle2
+                results = {{}}
+                def access(module, attr):
+                    try:
+                        results[attr] = getattr(module, attr)
+                    except Exception as exc:
+                        results[attr] = type(exc).__name__
+                threads = [threading.Thread(target=access, args=(cycle1, 'X')),
+                           threading.Thread(target=access, args=(cycle2, 'Y'))]
+                for thread in threads:
+                    thread.start()
+                for thread in threads:
+                    thread.join()
+                print(results['X'], results['Y'])
+                """)
+            proc = subprocess.run(
+                [sys.executable, '-B', '-X', 'lazy_imports', '-c', code],
+                capture_output=True, timeout=support.SHORT_TIMEOUT,
+                env=dict(os.environ, PYTHONPATH=''))
+            self.assertEqual(proc.returncode, 0, proc.stderr)
+            x, y = proc.stdout.decode().split()
+            self.assertIn(x, ('x', '_DeadlockError'))
+            self.assertIn(y, ('y', '_DeadlockError'))
+            # At least one of the threads succeeds.
+            self.assertTrue(x == 'x' or y == 'y', (x, y))
+
 
 if __name__ == '__main__':
     unittest.main()
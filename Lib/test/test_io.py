@@ -1804,6 +1804,29 @@ def test_writelines_userlist(self):
         bufio.flush()
         self.assertEqual(b''.join(writer._write_stack), b'abcdef')
 
+    def test_writelines_reused_buffer(self):
+        # The iterator may reuse a mutable buffer for the next line
+        def lines(buf):
+            for i in range(3):
+                buf[:] = b'%04d' % i
+                yield buf
+        writer = self.MockRawIO()
+        bufio = self.tp(writer, 100)
+        bufio.writelines(lines(bytearray(4)))
+        bufio.flush()
+        self.assertEqual(b''.join(writer._write_stack), b'000000010002')
+
+        # ... or resize it
+        def growing_lines(buf):
+            for i in range(3):
+                buf += b'%d' % i
+                yield buf
+        writer = self.MockRawIO()
+        bufio = self.tp(writer, 100)
+        bufio.writelines(growing_lines(bytearray()))
+        bufio.flush()
+        self.assertEqual(b''.join(writer._write_stack), b'001012')
+
     def test_writelines_error(self):
         writer = self.MockRawIO()
         bufio = self.tp(writer, 8)
@@ -1896,6 +1919,44 @@ def f():
         finally:
             os_helper.unlink(os_helper.TESTFN)
 
+    def test_write_sizes_file(self):
+        # Writes smaller and larger than the buffer on a real file, where
+        # the buffered data and the data that does not fit in the buffer can
+        # be written together.
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        chunks = [bytes([i % 256]) * size for i, size in
+                  enumerate([3, 20, 5, 1, 16, 15, 2, 40, 7, 7, 7, 0, 33])]
+        expected = b''.join(chunks) * 3
+        with self.open(os_helper.TESTFN, self.write_mode, buffering=0) as raw:
+            bufio = self.tp(raw, 16)
+            for chunk in chunks:
+                self.assertEqual(bufio.write(chunk), len(chunk))
+            self.assertEqual(bufio.tell(), len(expected) // 3)
+            bufio.writelines(chunks)
+            bufio.writelines(iter([bytearray(c) for c in chunks]))
+            self.assertEqual(bufio.tell(), len(expected))
+            bufio.seek(10)
+            bufio.writelines([b'x' * 20, b'y'])
+            bufio.flush()
+            self.assertEqual(bufio.tell(), 31)
+        expected = expected[:10] + b'x' * 20 + b'y' + expected[31:]
+        with self.open(os_helper.TESTFN, "rb") as f:
+            self.assertEqual(f.read(), expected)
+
+    def test_writelines_subclass(self):
+        # writelines() calls write() if it is overridden
+        written = []
+        class MyWriter(self.tp):
+            def write(self, b):
+                written.append(bytes(b))
+                return super().write(b)
+        writer = self.MockRawIO()
+        bufio = MyWriter(writer, 8)
+        bufio.writelines([b'ab', b'cdefghijk', b'l'])
+        bufio.flush()
+        self.assertEqual(written, [b'ab', b'cdefghijk', b'l'])
+        self.assertEqual(b''.join(writer._write_stack), b'abcdefghijkl')
+
     def test_misbehaved_io(self):
         rawio = self.MisbehavedRawIO()
         bufio = self.tp(rawio, 5)
@@ -2870,6 +2931,19 @@ def test_newlines_input(self):
             txt.seek(0)
             self.assertEqual(txt.read(), "".join(expected))
 
+    def test_newlines_input_universal(self):
+        # Universal newlines without translation, with lines longer than
+        # the chunk size and runs of \r.
+        lines = ["a" * 100 + "\n", "\r", "\r\n", "\r", "b" * 50 + "\r",
+                 "\r", "e\n", "c" * 300 + "\r\n", "\x00\r", "d" * 20]
+        for encoding in ("ascii", "latin-1", "utf-8", "utf-16"):
+            data = "".join(lines).encode(encoding)
+            for chunk_size in (1, 2, 7, 64, 8192):
+                txt = self.TextIOWrapper(self.BytesIO(data), newline="",
+                                         encoding=encoding)
+                txt._CHUNK_SIZE = chunk_size
+                self.assertEqual(list(txt), lines)
+
     def test_newlines_output(self):
         testdict = {
             "": b"AAA\nBBB\nCCC\nX\rY\r\nZ",
@@ -63,6 +63,45 @@ def test_keys_reuse(self):
         self.check_keys_reuse(s, decoder.decode)
         self.assertFalse(decoder.memo)
 
+    def test_repeated_object_shapes(self):
+        # Objects following each other at the same depth often share their
+        # keys; check that partially matching and diverging keys are decoded
+        # correctly.
+        s = ('[{"id": 1, "name": "a", "tags": {"x": 1, "y": 2}},'
+             ' {"id": 2, "name": "b", "tags": {"x": 3}},'
+             ' {"id": 3, "nam": "c", "tags": {"x": 4, "y": 5, "z": 6}},'
+             ' {"id": 4},'
+             ' {},'
+             ' {"id": 5, "name": "d", "extra": null},'
+             ' {"id\\u0031": 6, "nam\xe9": "e", "name\\"": "f"},'
+             ' {"id1": 7, "nam\xe9": "g", "name\\"": "h"},'
+             ' {"\U0001f600": 8, "name\\\\": 9},'
+             ' {"\U0001f600": 10, "name\\\\": 11}]')
+        expected = [
+            {"id": 1, "name": "a", "tags": {"x": 1, "y": 2}},
+            {"id": 2, "name": "b", "tags": {"x": 3}},
+            {"id": 3, "nam": "c", "tags": {"x": 4, "y": 5, "z": 6}},
+            {"id": 4},
+            {},
+            {"id": 5, "name": "d", "extra": None},
+            {"id1": 6, "nam\xe9": "e", 'name"': "f"},
+            {"id1": 7, "nam\xe9": "g", 'name"': "h"},
+            {"\U0001f600": 8, "name\\": 9},
+            {"\U0001f600": 10, "name\\": 11},
+        ]
+        self.assertEqual(self.loads(s), expected)
+        self.assertEqual(self.loads(s, object_pairs_hook=dict), expected)
+        rval = self.loads(s)
+        self.assertIs(list(rval[0])[1], list(rval[5])[1])
+        # A key matching the previous one must not hide an escape sequence
+        # or a syntax error that follows it.
+        self.assertEqual(self.loads('[{"a\\\\": 1}, {"a\\\\": 2}]'),
+                         [{"a\\": 1}, {"a\\": 2}])
+        self.assertRaises(self.JSONDecodeError, self.loads,
+                          '[{"a": 1}, {"a')
+        self.assertRaises(self.JSONDecodeError, self.loads,
+                          '[{"ab": 1}, {"a')
+
     def test_extra_data(self):
         s = '[1, 2, 3]5'
         msg = 'Extra data'
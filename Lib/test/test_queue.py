@@ -542,6 +542,64 @@ def test_negative_timeout_raises_exception(self):
         with self.assertRaises(ValueError):
             q.get(timeout=-1)
 
+    def test_put_many_get_many(self):
+        q = self.q
+        q.put_many(range(10))
+        q.put_many(iter([10, 11]))
+        q.put_many([])
+        self.assertEqual(q.qsize(), 12)
+        self.assertEqual(q.get(), 0)
+        self.assertEqual(q.get_many(3), [1, 2, 3])
+        self.assertEqual(q.get_many(0), [])
+        self.assertEqual(q.get_many(max_items=2, block=False), [4, 5])
+        self.assertEqual(q.get_many(), [6, 7, 8, 9, 10, 11])
+        self.assertTrue(q.empty())
+
+        q.put_many('ab')
+        self.assertEqual(q.get_many(-1), ['a', 'b'])
+        q.put(1)
+        self.assertEqual(q.get_many(None, timeout=0.1), [1])
+
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(block=False)
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(timeout=1e-3)
+        with self.assertRaises(ValueError):
+            q.get_many(timeout=-1)
+        with self.assertRaises(TypeError):
+            q.put_many(1)
+        with self.assertRaises(TypeError):
+            q.get_many('1')
+        self.assertTrue(q.empty())
+
+    def test_wraparound(self):
+        # Interleave puts and gets so that the items wrap around the end
+        # of the internal buffer while it grows and shrinks.
+        q = self.q
+        expected = 0
+        n = 0
+        for size in (3, 7, 30, 100, 5, 1000, 2):
+            q.put_many(range(n, n + size))
+            n += size
+            for item in q.get_many((size * 2) // 3):
+                self.assertEqual(item, expected)
+                expected += 1
+        while expected < n:
+            self.assertEqual(q.get(), expected)
+            expected += 1
+        self.assertTrue(q.empty())
+
+    def test_get_many_wakeup(self):
+        # A consumer blocked in get_many() gets the whole batch.
+        q = self.q
+        results = []
+        t = threading.Thread(target=lambda: results.append(q.get_many()))
+        with threading_helper.start_threads([t]):
+            time.sleep(0.01)
+            q.put_many(range(100))
+        self.assertEqual(results, [list(range(100))])
+        self.assertTrue(q.empty())
+
     def test_order(self):
         # Test a pair of concurrent put() and get()
         q = self.q
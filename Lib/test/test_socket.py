@@ -2697,6 +2697,82 @@ def testRecvFromNegative(self):
     def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
+    def recvmmsg_all(self, sizes):
+        # Receive len(sizes) datagrams, which may take several calls
+        received = []
+        addrs = set()
+        while len(received) < len(sizes):
+            bufs = [bytearray(n) for n in sizes[len(received):]]
+            res = self.serv.recvmmsg_into(bufs, 0, socket.MSG_WAITFORONE)
+            self.assertGreater(len(res), 0)
+            for buf, (nbytes, ancdata, flags, addr) in zip(bufs, res):
+                self.assertEqual(ancdata, [])
+                received.append(bytes(buf[:nbytes]))
+                addrs.add(addr)
+        self.assertEqual(len(addrs), 1)
+        return received
+
+    @requireAttrs(socket.socket, "recvmmsg_into", "sendmmsg")
+    @requireAttrs(socket, "MSG_WAITFORONE")
+    def testSendmmsgAndRecvmmsgInto(self):
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+        self.assertEqual(self.recvmmsg_all([len(MSG), 10, 1, 100]),
+                         [MSG, b'', b'x', bytes(range(100))])
+        # Datagrams larger than their buffer are truncated
+        self.assertEqual(self.recvmmsg_all([3]), [MSG[:3]])
+
+    def _testSendmmsgAndRecvmmsgInto(self):
+        self.assertEqual(self.cli.sendmmsg([], 0, (HOST, self.port)), 0)
+        msgs = [MSG, b'', bytearray(b'x'), memoryview(bytes(range(100)))]
+        sent = 0
+        while sent < len(msgs):
+            sent += self.cli.sendmmsg(msgs[sent:], 0, (HOST, self.port))
+        self.cli.connect((HOST, self.port))
+        self.assertEqual(self.cli.sendmmsg([MSG]), 1)
+
+    @requireAttrs(socket.socket, "recvmmsg_into")
+    @requireAttrs(socket, "UDP_GRO", "UDP_SEGMENT", "MSG_WAITFORONE",
+                  "CMSG_SPACE")
+    def testRecvmmsgIntoGRO(self):
+        # The segment size of coalesced datagrams is returned as
+        # ancillary data
+        try:
+            self.serv.setsockopt(socket.SOL_UDP, socket.UDP_GRO, 1)
+        except OSError:
+            self.skipTest("UDP_GRO is not supported")
+        with socket.socket(self.serv.family, socket.SOCK_DGRAM) as cli:
+            try:
+                cli.setsockopt(socket.SOL_UDP, socket.UDP_SEGMENT, 100)
+            except OSError:
+                self.skipTest("UDP_SEGMENT is not supported")
+            cli.sendto(b'x' * 350, (HOST, self.port))
+        bufs = [bytearray(1000) for _ in range(2)]
+        res = self.serv.recvmmsg_into(bufs, socket.CMSG_SPACE(SIZEOF_INT),
+                                      socket.MSG_WAITFORONE)
+        nbytes, ancdata, flags, addr = res[0]
+        self.assertEqual(bufs[0][:nbytes], b'x' * nbytes)
+        self.assertEqual(flags & socket.MSG_CTRUNC, 0)
+        if nbytes > 100:
+            # The datagrams were coalesced
+            self.assertEqual(ancdata, [(socket.SOL_UDP, socket.UDP_GRO,
+                                        struct.pack('i', 100))])
+
+    def _testRecvmmsgIntoGRO(self):
+        pass
+
+    @requireAttrs(socket.socket, "recvmmsg_into", "sendmmsg")
+    def testSendmmsgErrors(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'abc'])
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, None)
+        self.assertRaises(ValueError, self.serv.recvmmsg_into,
+                          [bytearray(1)], -1)
+        self.assertRaises(TypeError, self.serv.sendmmsg, ['abc'],
+                          0, (HOST, self.port))
+        self.assertRaises(TypeError, self.serv.sendmmsg, None)
+
+    def _testSendmmsgErrors(self):
+        pass
+
 
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
@@ -6761,6 +6837,71 @@ def close_fds(fds):
             self.assertEqual(data,  str(index).encode())
 
 
+@unittest.skipUnless(hasattr(socket, "MSG_ZEROCOPY"), "needs MSG_ZEROCOPY")
+class ZeroCopyTests(unittest.TestCase):
+
+    def connected_pair(self):
+        with socket.create_server((HOST, 0)) as srv:
+            cli = socket.create_connection(srv.getsockname())
+            self.addCleanup(cli.close)
+            conn, _ = srv.accept()
+            self.addCleanup(conn.close)
+        return cli, conn
+
+    def recv_completion(self, sock):
+        # Completions are queued on the error queue, which makes the
+        # socket readable.
+        select.select([sock], [], [], support.SHORT_TIMEOUT)
+        msg, ancdata, flags, addr = sock.recvmsg(
+            0, socket.CMSG_SPACE(64), socket.MSG_ERRQUEUE)
+        self.assertEqual(msg, b"")
+        self.assertTrue(flags & socket.MSG_ERRQUEUE)
+        self.assertEqual(len(ancdata), 1)
+        level, type, data = ancdata[0]
+        self.assertEqual((level, type), (socket.IPPROTO_IP, socket.IP_RECVERR))
+        # struct sock_extended_err
+        return struct.unpack_from("=IBBBBII", data)
+
+    def testSendZeroCopy(self):
+        cli, conn = self.connected_pair()
+        try:
+            cli.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+        except OSError as e:
+            self.skipTest(f"SO_ZEROCOPY not supported: {e}")
+        data = b"x" * 100_000
+        self.assertEqual(cli.send(data, socket.MSG_ZEROCOPY), len(data))
+        received = bytearray()
+        while len(received) < len(data):
+            received += conn.recv(len(data))
+        self.assertEqual(received, data)
+        err, origin, type, code, pad, lo, hi = self.recv_completion(cli)
+        self.assertEqual(err, 0)
+        self.assertEqual(origin, socket.SO_EE_ORIGIN_ZEROCOPY)
+        # The first send() has the notification number 0.
+        self.assertEqual((lo, hi), (0, 0))
+        # Loopback always falls back to copying.
+        self.assertIn(code, (0, socket.SO_EE_CODE_ZEROCOPY_COPIED))
+
+    @unittest.skipUnless(hasattr(os, "splice"), "needs os.splice()")
+    def testSpliceSocketToSocket(self):
+        src, src_peer = self.connected_pair()
+        dst, dst_peer = self.connected_pair()
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        data = b"spliced" * 1000
+        src_peer.sendall(data)
+        src_peer.shutdown(socket.SHUT_WR)
+        while n := os.splice(src.fileno(), w, 65536):
+            while n:
+                n -= os.splice(r, dst.fileno(), n)
+        dst.shutdown(socket.SHUT_WR)
+        received = bytearray()
+        while chunk := dst_peer.recv(65536):
+            received += chunk
+        self.assertEqual(received, data)
+
+
 def setUpModule():
     thread_info = threading_helper.threading_setup()
     unittest.addModuleCleanup(threading_helper.threading_cleanup, *thread_info)
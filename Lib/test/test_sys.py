@@ -269,6 +269,75 @@ def test_switchinterval(self):
         finally:
             sys.setswitchinterval(orig)
 
+    @threading_helper.reap_threads
+    @threading_helper.requires_working_threading()
+    def test_get_gil_stats(self):
+        import threading
+        import time
+
+        keys = {'acquisitions', 'forced_drops', 'wait_ns', 'hold_ns',
+                'hold_histogram'}
+        stats = sys._get_gil_stats()
+        self.assertTrue(keys <= stats.keys())
+        self.assertIsInstance(stats['timing'], bool)
+        self.assertIn(threading.get_ident(), stats['threads'])
+        thread_stats = stats['threads'][threading.get_ident()]
+        self.assertEqual(thread_stats.keys(), keys)
+        for key in keys - {'hold_histogram'}:
+            self.assertIsInstance(thread_stats[key], int)
+            self.assertGreaterEqual(thread_stats[key], 0)
+            self.assertGreaterEqual(stats[key], thread_stats[key])
+        self.assertIsInstance(thread_stats['hold_histogram'], tuple)
+        self.assertEqual(len(thread_stats['hold_histogram']),
+                         len(stats['hold_histogram']))
+
+        # A thread blocked on the GIL held by the main thread accumulates
+        # waiting time.
+        started = threading.Event()
+        def f():
+            started.set()
+            time.sleep(0.01)
+            return sys._get_gil_stats()['threads'][threading.get_ident()]
+        results = []
+        t = threading.Thread(target=lambda: results.append(f()))
+        t.start()
+        started.wait()
+        deadline = time.monotonic() + 0.05
+        while time.monotonic() < deadline:
+            pass
+        t.join()
+        self.assertGreater(results[0]['wait_ns'], 0)
+        self.assertGreater(results[0]['acquisitions'], 0)
+
+    @threading_helper.reap_threads
+    @threading_helper.requires_working_threading()
+    def test_set_gil_timing(self):
+        import threading
+        import time
+
+        old_timing = sys._get_gil_stats()['timing']
+        self.addCleanup(sys._set_gil_timing, old_timing)
+        sys._set_gil_timing(True)
+        self.assertIs(sys._get_gil_stats()['timing'], True)
+
+        # The GIL is held for the whole busy loop, and the hold is recorded
+        # once the main thread releases it to the sleeping thread.
+        def f():
+            time.sleep(0.01)
+        t = threading.Thread(target=f)
+        t.start()
+        deadline = time.monotonic() + 0.02
+        while time.monotonic() < deadline:
+            pass
+        t.join()
+        stats = sys._get_gil_stats()['threads'][threading.get_ident()]
+        self.assertGreater(stats['hold_ns'], 0)
+        self.assertGreater(sum(stats['hold_histogram']), 0)
+
+        sys._set_gil_timing(False)
+        self.assertIs(sys._get_gil_stats()['timing'], False)
+        self.assertRaises(TypeError, sys._set_gil_timing)
+
     def test_recursionlimit(self):
         self.assertRaises(TypeError, sys.getrecursionlimit, 42)
         oldlimit = sys.getrecursionlimit()
@@ -633,7 +702,7 @@ def test_thread_info(self):
         info = sys.thread_info
         self.assertEqual(len(info), 3)
         self.assertIn(info.name, ('nt', 'pthread', 'pthread-stubs', 'solaris', None))
-        self.assertIn(info.lock, ('semaphore', 'mutex+cond', None))
+        self.assertIn(info.lock, ('futex', 'semaphore', 'mutex+cond', None))
         if sys.platform.startswith(("linux", "freebsd")):
             self.assertEqual(info.name, "pthread")
         elif sys.platform == "win32":
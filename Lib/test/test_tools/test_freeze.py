@@ -28,3 +28,17 @@ def test_freeze_simple_script(self):
             executable = helper.freeze(python, scriptfile, outdir)
             text = helper.run(executable)
         self.assertEqual(text, 'running...')
+
+    def test_deepfreeze_simple_script(self):
+        script = textwrap.dedent("""
+            import sys
+            import json
+            print(json.dumps({'running': sys.flags.optimize}))
+            sys.exit(0)
+            """)
+        with os_helper.temp_dir() as outdir:
+            outdir, scriptfile, python = helper.prepare(script, outdir)
+            executable = helper.freeze(python, scriptfile, outdir,
+                                       deepfreeze=True)
+            text = helper.run(executable)
+        self.assertEqual(text, '{"running": 0}')
@@ -35,6 +35,10 @@ typedef struct {
     /* WeakSet containing all alive tasks. */
     PyObject *all_tasks;
 
+    /* Set containing the tasks which are running their first step
+       eagerly.  They are moved to all_tasks if they suspend. */
+    PyObject *eager_tasks;
+
     /* An isinstance type cache for the 'is_coroutine()' function. */
     PyObject *iscoroutine_typecache;
 
@@ -64,6 +68,10 @@ typedef struct {
 
     /* Counter for autogenerated Task names */
     uint64_t task_name_counter;
+
+    /* Free list of TaskStepMethWrapper objects, linked through sw_task. */
+    struct _TaskStepMethWrapper *tsw_freelist;
+    Py_ssize_t tsw_freelist_len;
 } asyncio_state;
 
 static inline asyncio_state *
@@ -99,11 +107,16 @@ typedef enum {
     STATE_FINISHED
 } fut_state;
 
+/* Number of done callbacks stored in the future object itself before
+   falling back to the 'callbacks' list. */
+#define FUT_INLINE_CALLBACKS 3
+
 #define FutureObj_HEAD(prefix)                                              \
     PyObject_HEAD                                                           \
     PyObject *prefix##_loop;                                                \
-    PyObject *prefix##_callback0;                                           \
-    PyObject *prefix##_context0;                                            \
+    PyObject *prefix##_inline_callbacks[FUT_INLINE_CALLBACKS];              \
+    PyObject *prefix##_inline_contexts[FUT_INLINE_CALLBACKS];               \
+    Py_ssize_t prefix##_inline_len;                                         \
     PyObject *prefix##_callbacks;                                           \
     PyObject *prefix##_exception;                                           \
     PyObject *prefix##_exception_tb;                                        \
@@ -132,7 +145,7 @@ typedef struct {
     int task_num_cancels_requested;
 } TaskObj;
 
-typedef struct {
+typedef struct _TaskStepMethWrapper {
     PyObject_HEAD
     TaskObj *sw_task;
     PyObject *sw_arg;
@@ -451,21 +464,47 @@ future_ensure_alive(FutureObj *fut)
     } while(0);
 
 
+static void
+future_clear_inline_callbacks(FutureObj *fut)
+{
+    Py_ssize_t n = fut->fut_inline_len;
+    fut->fut_inline_len = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_CLEAR(fut->fut_inline_callbacks[i]);
+        Py_CLEAR(fut->fut_inline_contexts[i]);
+    }
+}
+
 static int
 future_schedule_callbacks(asyncio_state *state, FutureObj *fut)
 {
     Py_ssize_t len;
     Py_ssize_t i;
 
-    if (fut->fut_callback0 != NULL) {
-        /* There's a 1st callback */
-
-        int ret = call_soon(state,
-            fut->fut_loop, fut->fut_callback0,
-            (PyObject *)fut, fut->fut_context0);
-
-        Py_CLEAR(fut->fut_callback0);
-        Py_CLEAR(fut->fut_context0);
+    if (fut->fut_inline_len) {
+        /* Take the inline callbacks out of the future first: call_soon()
+           may run arbitrary code which could try to modify them. */
+        PyObject *callbacks[FUT_INLINE_CALLBACKS];
+        PyObject *contexts[FUT_INLINE_CALLBACKS];
+        Py_ssize_t n = fut->fut_inline_len;
+        int ret = 0;
+
+        for (i = 0; i < n; i++) {
+            callbacks[i] = fut->fut_inline_callbacks[i];
+            contexts[i] = fut->fut_inline_contexts[i];
+            fut->fut_inline_callbacks[i] = NULL;
+            fut->fut_inline_contexts[i] = NULL;
+        }
+        fut->fut_inline_len = 0;
+
+        for (i = 0; i < n; i++) {
+            if (ret == 0) {
+                ret = call_soon(state, fut->fut_loop, callbacks[i],
+                                (PyObject *)fut, contexts[i]);
+            }
+            Py_DECREF(callbacks[i]);
+            Py_DECREF(contexts[i]);
+        }
         if (ret) {
             /* If an error occurs in pure-Python implementation,
                all callbacks are cleared. */
@@ -473,7 +512,7 @@ future_schedule_callbacks(asyncio_state *state, FutureObj *fut)
             return ret;
         }
 
-        /* we called the first callback, now try calling
+        /* we called the inline callbacks, now try calling
            callbacks from the 'fut_callbacks' list. */
     }
 
@@ -515,8 +554,7 @@ future_init(FutureObj *fut, PyObject *loop)
 
     // Same to FutureObj_clear() but not clearing fut->dict
     Py_CLEAR(fut->fut_loop);
-    Py_CLEAR(fut->fut_callback0);
-    Py_CLEAR(fut->fut_context0);
+    future_clear_inline_callbacks(fut);
     Py_CLEAR(fut->fut_callbacks);
     Py_CLEAR(fut->fut_result);
     Py_CLEAR(fut->fut_exception);
@@ -723,8 +761,12 @@ future_add_done_callback(asyncio_state *state, FutureObj *fut, PyObject *arg,
 
            Callbacks in the future object are stored as follows:
 
-              callback0 -- a pointer to the first callback
-              callbacks -- a list of 2nd, 3rd, ... callbacks
+              inline_callbacks -- the first FUT_INLINE_CALLBACKS callbacks
+              inline_contexts  -- their contexts
+              inline_len       -- the number of inline callbacks
+              callbacks        -- a list of the callbacks that follow
+
+           The inline callbacks always come before the ones in the list.
 
            Invariants:
 
@@ -732,17 +774,20 @@ future_add_done_callback(asyncio_state *state, FutureObj *fut, PyObject *arg,
                 There are some callbacks in in the list.  Just
                 add the new callback to it.
 
-            * callbacks == NULL and callback0 == NULL:
-                This is the first callback.  Set it to callback0.
+            * callbacks == NULL and inline_len < FUT_INLINE_CALLBACKS:
+                Store the new callback inline.
 
-            * callbacks == NULL and callback0 != NULL:
-                This is a second callback.  Initialize callbacks
+            * callbacks == NULL and inline_len == FUT_INLINE_CALLBACKS:
+                All inline slots are taken.  Initialize callbacks
                 with a new list and add the new callback to it.
         */
 
-        if (fut->fut_callbacks == NULL && fut->fut_callback0 == NULL) {
-            fut->fut_callback0 = Py_NewRef(arg);
-            fut->fut_context0 = Py_NewRef(ctx);
+        if (fut->fut_callbacks == NULL &&
+                fut->fut_inline_len < FUT_INLINE_CALLBACKS) {
+            Py_ssize_t n = fut->fut_inline_len;
+            fut->fut_inline_callbacks[n] = Py_NewRef(arg);
+            fut->fut_inline_contexts[n] = Py_NewRef(ctx);
+            fut->fut_inline_len = n + 1;
         }
         else {
             PyObject *tup = PyTuple_New(2);
@@ -829,8 +874,7 @@ static int
 FutureObj_clear(FutureObj *fut)
 {
     Py_CLEAR(fut->fut_loop);
-    Py_CLEAR(fut->fut_callback0);
-    Py_CLEAR(fut->fut_context0);
+    future_clear_inline_callbacks(fut);
     Py_CLEAR(fut->fut_callbacks);
     Py_CLEAR(fut->fut_result);
     Py_CLEAR(fut->fut_exception);
@@ -847,8 +891,10 @@ FutureObj_traverse(FutureObj *fut, visitproc visit, void *arg)
 {
     Py_VISIT(Py_TYPE(fut));
     Py_VISIT(fut->fut_loop);
-    Py_VISIT(fut->fut_callback0);
-    Py_VISIT(fut->fut_context0);
+    for (Py_ssize_t i = 0; i < fut->fut_inline_len; i++) {
+        Py_VISIT(fut->fut_inline_callbacks[i]);
+        Py_VISIT(fut->fut_inline_contexts[i]);
+    }
     Py_VISIT(fut->fut_callbacks);
     Py_VISIT(fut->fut_result);
     Py_VISIT(fut->fut_exception);
@@ -1045,32 +1091,50 @@ _asyncio_Future_remove_done_callback_impl(FutureObj *self, PyTypeObject *cls,
 {
     PyObject *newlist;
     Py_ssize_t len, i, j=0;
-    Py_ssize_t cleared_callback0 = 0;
+    Py_ssize_t cleared_inline = 0;
 
     asyncio_state *state = get_asyncio_state_by_cls(cls);
     ENSURE_FUTURE_ALIVE(state, self)
 
-    if (self->fut_callback0 != NULL) {
-        int cmp = PyObject_RichCompareBool(self->fut_callback0, fn, Py_EQ);
+    // Beware: PyObject_RichCompareBool below may change the inline
+    // callbacks, so re-check the bounds and the slot on every iteration.
+    i = 0;
+    while (i < self->fut_inline_len) {
+        PyObject *cb = Py_NewRef(self->fut_inline_callbacks[i]);
+        int cmp = PyObject_RichCompareBool(cb, fn, Py_EQ);
         if (cmp == -1) {
+            Py_DECREF(cb);
             return NULL;
         }
-        if (cmp == 1) {
-            /* callback0 == fn */
-            Py_CLEAR(self->fut_callback0);
-            Py_CLEAR(self->fut_context0);
-            cleared_callback0 = 1;
+        if (cmp == 1 && i < self->fut_inline_len &&
+                self->fut_inline_callbacks[i] == cb) {
+            /* inline_callbacks[i] == fn: remove it keeping the order */
+            PyObject *ctx = self->fut_inline_contexts[i];
+            Py_ssize_t n = --self->fut_inline_len;
+            for (Py_ssize_t k = i; k < n; k++) {
+                self->fut_inline_callbacks[k] = self->fut_inline_callbacks[k + 1];
+                self->fut_inline_contexts[k] = self->fut_inline_contexts[k + 1];
+            }
+            self->fut_inline_callbacks[n] = NULL;
+            self->fut_inline_contexts[n] = NULL;
+            Py_DECREF(cb);
+            Py_DECREF(ctx);
+            cleared_inline++;
         }
+        else {
+            i++;
+        }
+        Py_DECREF(cb);
     }
 
     if (self->fut_callbacks == NULL) {
-        return PyLong_FromSsize_t(cleared_callback0);
+        return PyLong_FromSsize_t(cleared_inline);
     }
 
     len = PyList_GET_SIZE(self->fut_callbacks);
     if (len == 0) {
         Py_CLEAR(self->fut_callbacks);
-        return PyLong_FromSsize_t(cleared_callback0);
+        return PyLong_FromSsize_t(cleared_inline);
     }
 
     if (len == 1) {
@@ -1083,10 +1147,10 @@ _asyncio_Future_remove_done_callback_impl(FutureObj *self, PyTypeObject *cls,
         if (cmp == 1) {
             /* callbacks[0] == fn */
             Py_CLEAR(self->fut_callbacks);
-            return PyLong_FromSsize_t(1 + cleared_callback0);
+            return PyLong_FromSsize_t(1 + cleared_inline);
         }
         /* callbacks[0] != fn and len(callbacks) == 1 */
-        return PyLong_FromSsize_t(cleared_callback0);
+        return PyLong_FromSsize_t(cleared_inline);
     }
 
     newlist = PyList_New(len);
@@ -1121,7 +1185,7 @@ _asyncio_Future_remove_done_callback_impl(FutureObj *self, PyTypeObject *cls,
     if (j == 0 || self->fut_callbacks == NULL) {
         Py_CLEAR(self->fut_callbacks);
         Py_DECREF(newlist);
-        return PyLong_FromSsize_t(len + cleared_callback0);
+        return PyLong_FromSsize_t(len + cleared_inline);
     }
 
     if (j < len) {
@@ -1135,7 +1199,7 @@ _asyncio_Future_remove_done_callback_impl(FutureObj *self, PyTypeObject *cls,
         }
     }
     Py_DECREF(newlist);
-    return PyLong_FromSsize_t(len - j + cleared_callback0);
+    return PyLong_FromSsize_t(len - j + cleared_inline);
 
 fail:
     Py_DECREF(newlist);
@@ -1303,7 +1367,8 @@ FutureObj_get_callbacks(FutureObj *fut, void *Py_UNUSED(ignored))
 
     ENSURE_FUTURE_ALIVE(state, fut)
 
-    if (fut->fut_callback0 == NULL) {
+    Py_ssize_t n = fut->fut_inline_len;
+    if (n == 0) {
         if (fut->fut_callbacks == NULL) {
             Py_RETURN_NONE;
         }
@@ -1311,7 +1376,7 @@ FutureObj_get_callbacks(FutureObj *fut, void *Py_UNUSED(ignored))
         return Py_NewRef(fut->fut_callbacks);
     }
 
-    Py_ssize_t len = 1;
+    Py_ssize_t len = n;
     if (fut->fut_callbacks != NULL) {
         len += PyList_GET_SIZE(fut->fut_callbacks);
     }
@@ -1322,25 +1387,27 @@ FutureObj_get_callbacks(FutureObj *fut, void *Py_UNUSED(ignored))
         return NULL;
     }
 
-    PyObject *tup0 = PyTuple_New(2);
-    if (tup0 == NULL) {
-        Py_DECREF(new_list);
-        return NULL;
-    }
+    for (i = 0; i < n; i++) {
+        PyObject *tup = PyTuple_New(2);
+        if (tup == NULL) {
+            Py_DECREF(new_list);
+            return NULL;
+        }
 
-    Py_INCREF(fut->fut_callback0);
-    PyTuple_SET_ITEM(tup0, 0, fut->fut_callback0);
-    assert(fut->fut_context0 != NULL);
-    Py_INCREF(fut->fut_context0);
-    PyTuple_SET_ITEM(tup0, 1, (PyObject *)fut->fut_context0);
+        Py_INCREF(fut->fut_inline_callbacks[i]);
+        PyTuple_SET_ITEM(tup, 0, fut->fut_inline_callbacks[i]);
+        assert(fut->fut_inline_contexts[i] != NULL);
+        Py_INCREF(fut->fut_inline_contexts[i]);
+        PyTuple_SET_ITEM(tup, 1, fut->fut_inline_contexts[i]);
 
-    PyList_SET_ITEM(new_list, 0, tup0);
+        PyList_SET_ITEM(new_list, i, tup);
+    }
 
     if (fut->fut_callbacks != NULL) {
         for (i = 0; i < PyList_GET_SIZE(fut->fut_callbacks); i++) {
             PyObject *cb = PyList_GET_ITEM(fut->fut_callbacks, i);
             Py_INCREF(cb);
-            PyList_SET_ITEM(new_list, i + 1, cb);
+            PyList_SET_ITEM(new_list, i + n, cb);
         }
     }
 
@@ -1855,6 +1922,9 @@ future_new_iter(PyObject *fut)
 /*********************** Task **************************/
 
 
+#define TSW_FREELIST_MAXLEN 255
+
+
 /*[clinic input]
 class _asyncio.Task "TaskObj *" "&Task_Type"
 [clinic start generated code]*/
@@ -1863,6 +1933,7 @@ class _asyncio.Task "TaskObj *" "&Task_Type"
 static int task_call_step_soon(asyncio_state *state, TaskObj *, PyObject *);
 static PyObject * task_wakeup(TaskObj *, PyObject *);
 static PyObject * task_step(asyncio_state *, TaskObj *, PyObject *);
+static int task_eager_start(asyncio_state *state, TaskObj *task);
 
 /* ----- Task._step wrapper */
 
@@ -1880,6 +1951,16 @@ TaskStepMethWrapper_dealloc(TaskStepMethWrapper *o)
     PyTypeObject *tp = Py_TYPE(o);
     PyObject_GC_UnTrack(o);
     (void)TaskStepMethWrapper_clear(o);
+
+    asyncio_state *state = get_asyncio_state_by_def((PyObject *)o);
+    if (tp == state->TaskStepMethWrapper_Type &&
+            state->tsw_freelist_len < TSW_FREELIST_MAXLEN) {
+        /* Keep the reference to the type for the reuse. */
+        state->tsw_freelist_len++;
+        o->sw_task = (TaskObj *)state->tsw_freelist;
+        state->tsw_freelist = o;
+        return;
+    }
     Py_TYPE(o)->tp_free(o);
     Py_DECREF(tp);
 }
@@ -1947,9 +2028,18 @@ TaskStepMethWrapper_new(TaskObj *task, PyObject *arg)
 {
     asyncio_state *state = get_asyncio_state_by_def((PyObject *)task);
     TaskStepMethWrapper *o;
-    o = PyObject_GC_New(TaskStepMethWrapper, state->TaskStepMethWrapper_Type);
-    if (o == NULL) {
-        return NULL;
+    if (state->tsw_freelist_len) {
+        state->tsw_freelist_len--;
+        o = state->tsw_freelist;
+        state->tsw_freelist = (TaskStepMethWrapper *)o->sw_task;
+        _Py_NewReference((PyObject *)o);
+    }
+    else {
+        o = PyObject_GC_New(TaskStepMethWrapper,
+                            state->TaskStepMethWrapper_Type);
+        if (o == NULL) {
+            return NULL;
+        }
     }
 
     o->sw_task = (TaskObj*)Py_NewRef(task);
@@ -1996,6 +2086,23 @@ unregister_task(asyncio_state *state, PyObject *task)
 }
 
 
+static int
+register_eager_task(asyncio_state *state, PyObject *task)
+{
+    return PySet_Add(state->eager_tasks, task);
+}
+
+
+static int
+unregister_eager_task(asyncio_state *state, PyObject *task)
+{
+    if (PySet_Discard(state->eager_tasks, task) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+
 static int
 enter_task(asyncio_state *state, PyObject *loop, PyObject *task)
 {
@@ -2048,6 +2155,45 @@ leave_task(asyncio_state *state, PyObject *loop, PyObject *task)
     return _PyDict_DelItem_KnownHash(state->current_tasks, loop, hash);
 }
 
+
+/* Make task the current task of loop, or make loop have no current
+   task if task is None, and return a new reference to the previous
+   current task (or None). */
+static PyObject *
+swap_current_task(asyncio_state *state, PyObject *loop, PyObject *task)
+{
+    PyObject *prev_task;
+    Py_hash_t hash;
+    hash = PyObject_Hash(loop);
+    if (hash == -1) {
+        return NULL;
+    }
+    prev_task = _PyDict_GetItem_KnownHash(state->current_tasks, loop, hash);
+    if (prev_task == NULL) {
+        if (PyErr_Occurred()) {
+            return NULL;
+        }
+        prev_task = Py_None;
+    }
+    Py_INCREF(prev_task);
+
+    int res;
+    if (task != Py_None) {
+        res = _PyDict_SetItem_KnownHash(state->current_tasks, loop, task, hash);
+    }
+    else if (prev_task != Py_None) {
+        res = _PyDict_DelItem_KnownHash(state->current_tasks, loop, hash);
+    }
+    else {
+        res = 0;
+    }
+    if (res < 0) {
+        Py_DECREF(prev_task);
+        return NULL;
+    }
+    return prev_task;
+}
+
 /* ----- Task */
 
 /*[clinic input]
@@ -2058,14 +2204,16 @@ _asyncio.Task.__init__
     loop: object = None
     name: object = None
     context: object = None
+    eager_start: bool(accept={int}) = False
 
 A coroutine wrapped in a Future.
 [clinic start generated code]*/
 
 static int
 _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
-                            PyObject *name, PyObject *context)
-/*[clinic end generated code: output=49ac96fe33d0e5c7 input=924522490c8ce825]*/
+                            PyObject *name, PyObject *context,
+                            int eager_start)
+/*[clinic end generated code: output=7aced2d27836f1a1 input=8374896531326611]*/
 
 {
     if (future_init((FutureObj*)self, loop)) {
@@ -2114,6 +2262,19 @@ _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
         return -1;
     }
 
+    if (eager_start) {
+        PyObject *res = PyObject_CallMethodNoArgs(self->task_loop,
+                                                  &_Py_ID(is_running));
+        if (res == NULL) {
+            return -1;
+        }
+        int is_running = Py_IsTrue(res);
+        Py_DECREF(res);
+        if (is_running) {
+            return task_eager_start(state, self);
+        }
+    }
+
     if (task_call_step_soon(state, self, NULL)) {
         return -1;
     }
@@ -2141,8 +2302,10 @@ TaskObj_traverse(TaskObj *task, visitproc visit, void *arg)
     Py_VISIT(task->task_fut_waiter);
     FutureObj *fut = (FutureObj *)task;
     Py_VISIT(fut->fut_loop);
-    Py_VISIT(fut->fut_callback0);
-    Py_VISIT(fut->fut_context0);
+    for (Py_ssize_t i = 0; i < fut->fut_inline_len; i++) {
+        Py_VISIT(fut->fut_inline_callbacks[i]);
+        Py_VISIT(fut->fut_inline_contexts[i]);
+    }
     Py_VISIT(fut->fut_callbacks);
     Py_VISIT(fut->fut_result);
     Py_VISIT(fut->fut_exception);
@@ -2457,7 +2620,11 @@ static PyObject *
 _asyncio_Task_get_coro_impl(TaskObj *self)
 /*[clinic end generated code: output=bcac27c8cc6c8073 input=d2e8606c42a7b403]*/
 {
-    return Py_NewRef(self->task_coro);
+    if (self->task_coro) {
+        return Py_NewRef(self->task_coro);
+    }
+
+    Py_RETURN_NONE;
 }
 
 /*[clinic input]
@@ -3101,6 +3268,77 @@ task_step(asyncio_state *state, TaskObj *task, PyObject *exc)
     }
 }
 
+/* Run the first step of a task synchronously, as the current task of
+   its loop and in its context.  The task is registered in all_tasks
+   only if it did not finish during that step. */
+static int
+task_eager_start(asyncio_state *state, TaskObj *task)
+{
+    PyObject *et = NULL, *ev = NULL, *tb = NULL;
+    int retval = 0;
+
+    PyObject *prevtask = swap_current_task(state, task->task_loop,
+                                           (PyObject *)task);
+    if (prevtask == NULL) {
+        return -1;
+    }
+
+    if (register_eager_task(state, (PyObject *)task) < 0) {
+        goto restore;
+    }
+
+    if (PyContext_Enter(task->task_context) < 0) {
+        (void)unregister_eager_task(state, (PyObject *)task);
+        goto restore;
+    }
+
+    PyObject *stepres = task_step_impl(state, task, NULL);
+    if (stepres == NULL) {
+        PyErr_Fetch(&et, &ev, &tb);
+        retval = -1;
+    }
+    else {
+        Py_DECREF(stepres);
+    }
+
+    if (PyContext_Exit(task->task_context) < 0) {
+        _PyErr_ChainExceptions(et, ev, tb);
+        PyErr_Fetch(&et, &ev, &tb);
+        retval = -1;
+    }
+    if (unregister_eager_task(state, (PyObject *)task) < 0) {
+        _PyErr_ChainExceptions(et, ev, tb);
+        PyErr_Fetch(&et, &ev, &tb);
+        retval = -1;
+    }
+    goto swap_back;
+
+restore:
+    PyErr_Fetch(&et, &ev, &tb);
+    retval = -1;
+
+swap_back:;
+    PyObject *curtask = swap_current_task(state, task->task_loop, prevtask);
+    Py_DECREF(prevtask);
+    if (curtask == NULL) {
+        _PyErr_ChainExceptions(et, ev, tb);
+        return -1;
+    }
+    assert(curtask == (PyObject *)task);
+    Py_DECREF(curtask);
+
+    if (retval == 0) {
+        if (task->task_state == STATE_PENDING) {
+            return register_task(state, (PyObject *)task);
+        }
+        /* The coroutine is exhausted: release it early. */
+        Py_CLEAR(task->task_coro);
+        return 0;
+    }
+    PyErr_Restore(et, ev, tb);
+    return -1;
+}
+
 static PyObject *
 task_wakeup(TaskObj *task, PyObject *o)
 {
@@ -3294,6 +3532,50 @@ _asyncio__unregister_task_impl(PyObject *module, PyObject *task)
 }
 
 
+/*[clinic input]
+_asyncio._register_eager_task
+
+    task: object
+
+Register a new task which is running its first step eagerly.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__register_eager_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=dfe1d45367c73f1a input=65b6e98594d0976a]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    if (register_eager_task(state, task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._unregister_eager_task
+
+    task: object
+
+Unregister a task which was running its first step eagerly.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__unregister_eager_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=a426922bd07f23d1 input=62293a02bcd0206d]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    if (unregister_eager_task(state, task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
 /*[clinic input]
 _asyncio._enter_task
 
@@ -3344,6 +3626,26 @@ _asyncio__leave_task_impl(PyObject *module, PyObject *loop, PyObject *task)
 }
 
 
+/*[clinic input]
+_asyncio._swap_current_task
+
+    loop: object
+    task: object
+
+Make task the current task of loop, or clear it if task is None.
+
+Returns the previous current task of loop, or None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__swap_current_task_impl(PyObject *module, PyObject *loop,
+                                 PyObject *task)
+/*[clinic end generated code: output=9f88de958df74c7e input=70410716a67f0da9]*/
+{
+    return swap_current_task(get_asyncio_state(module), loop, task);
+}
+
+
 /*********************** PyRunningLoopHolder ********************/
 
 
@@ -3421,11 +3723,25 @@ static PyType_Spec PyRunningLoopHolder_spec = {
 
 
 static void
-module_free_freelists(void)
+module_free_freelists(asyncio_state *state)
 {
     PyObject *next;
     PyObject *current;
 
+    TaskStepMethWrapper *sw = state->tsw_freelist;
+    while (sw != NULL) {
+        assert(state->tsw_freelist_len > 0);
+        state->tsw_freelist_len--;
+
+        TaskStepMethWrapper *sw_next = (TaskStepMethWrapper *)sw->sw_task;
+        PyTypeObject *tp = Py_TYPE(sw);
+        PyObject_GC_Del(sw);
+        Py_DECREF(tp);
+        sw = sw_next;
+    }
+    assert(state->tsw_freelist_len == 0);
+    state->tsw_freelist = NULL;
+
     next = (PyObject*) fi_freelist;
     while (next != NULL) {
         assert(fi_freelist_len > 0);
@@ -3462,6 +3778,7 @@ module_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->asyncio_CancelledError);
 
     Py_VISIT(state->all_tasks);
+    Py_VISIT(state->eager_tasks);
     Py_VISIT(state->current_tasks);
     Py_VISIT(state->iscoroutine_typecache);
 
@@ -3500,12 +3817,13 @@ module_clear(PyObject *mod)
     Py_CLEAR(state->asyncio_CancelledError);
 
     Py_CLEAR(state->all_tasks);
+    Py_CLEAR(state->eager_tasks);
     Py_CLEAR(state->current_tasks);
     Py_CLEAR(state->iscoroutine_typecache);
 
     Py_CLEAR(state->context_kwname);
 
-    module_free_freelists();
+    module_free_freelists(state);
 
     return 0;
 }
@@ -3536,6 +3854,11 @@ module_init(asyncio_state *state)
         goto fail;
     }
 
+    state->eager_tasks = PySet_New(NULL);
+    if (state->eager_tasks == NULL) {
+        goto fail;
+    }
+
 
     state->context_kwname = Py_BuildValue("(s)", "context");
     if (state->context_kwname == NULL) {
@@ -3607,6 +3930,9 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO__UNREGISTER_TASK_METHODDEF
     _ASYNCIO__ENTER_TASK_METHODDEF
     _ASYNCIO__LEAVE_TASK_METHODDEF
+    _ASYNCIO__SWAP_CURRENT_TASK_METHODDEF
+    _ASYNCIO__REGISTER_EAGER_TASK_METHODDEF
+    _ASYNCIO__UNREGISTER_EAGER_TASK_METHODDEF
     {NULL, NULL}
 };
 
@@ -3648,6 +3974,10 @@ module_exec(PyObject *mod)
         return -1;
     }
 
+    if (PyModule_AddObjectRef(mod, "_eager_tasks", state->eager_tasks) < 0) {
+        return -1;
+    }
+
     if (PyModule_AddObjectRef(mod, "_current_tasks", state->current_tasks) < 0) {
         return -1;
     }
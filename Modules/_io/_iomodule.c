@@ -341,7 +341,12 @@ _io_open_impl(PyObject *module, PyObject *file, const char *mode,
 
     /* buffering */
     if (buffering < 0) {
-        PyObject *res = PyObject_CallMethodNoArgs(raw, &_Py_ID(isatty));
+        /* Only FileIO knows whether the file was a regular file when it was
+           opened; other raw classes, such as _WindowsConsoleIO, are asked
+           the usual way. */
+        PyObject *res = PyObject_CallMethodNoArgs(raw,
+            Py_IS_TYPE(raw, &PyFileIO_Type) ? &_Py_ID(_isatty_open_only)
+                                            : &_Py_ID(isatty));
         if (res == NULL)
             goto error;
         isatty = PyObject_IsTrue(res);
@@ -48,6 +48,16 @@ extern int _PyIOBase_finalize(PyObject *self);
    Doesn't check the argument type, so be careful! */
 extern int _PyFileIO_closed(PyObject *self);
 
+#ifdef HAVE_WRITEV
+/* Writes the buffers of iov to the given FileIO object with a single
+   writev() call.  Returns the number of bytes written, -2 if the call
+   would block, or -1 with an exception set.
+   Doesn't check the argument type either. */
+struct iovec;
+extern Py_ssize_t _PyFileIO_writev(PyObject *self,
+                                   const struct iovec *iov, int iovcnt);
+#endif
+
 /* Shortcut to the core of the IncrementalNewlineDecoder.decode method */
 extern PyObject *_PyIncrementalNewlineDecoder_decode(
     PyObject *self, PyObject *input, int final);
@@ -14,6 +14,10 @@
 #include "structmember.h"         // PyMemberDef
 #include "_iomodule.h"
 
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>              // struct iovec
+#endif
+
 /*[clinic input]
 module _io
 class _io._BufferedIOBase "PyObject *" "&PyBufferedIOBase_Type"
@@ -1893,31 +1897,96 @@ _bufferedwriter_flush_unlocked(buffered *self)
     return NULL;
 }
 
-/*[clinic input]
-_io.BufferedWriter.write
-    buffer: Py_buffer
-    /
-[clinic start generated code]*/
-
-static PyObject *
-_io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
-/*[clinic end generated code: output=7f8d1365759bfc6b input=dd87dd85fc7f8850]*/
+#ifdef HAVE_WRITEV
+/* Check that the raw stream is a FileIO positioned right after the data
+   waiting in the write buffer, so that new data can be written along with
+   it by _bufferedwriter_writev(). */
+#define CAN_WRITEV(self) \
+    (self->fast_closed_checks && \
+     (VALID_WRITE_BUFFER(self) \
+      ? (self->raw_pos == self->write_pos && self->pos == self->write_end) \
+      : RAW_OFFSET(self) == 0))
+
+/* Write the data waiting in the write buffer followed by the buffers
+   iov[1] to iov[iovcnt - 1] with as few writev() calls as possible, so that
+   data which does not fit in the buffer costs neither a copy nor a system
+   call of its own.  iov[0] is used for the buffered data and the other
+   entries are modified as they get written.
+
+   Return the number of bytes written from iov[1:], which is less than their
+   total size only if the raw stream would block, or -1 with an exception
+   set.  The write buffer is emptied once all of its data is written. */
+static Py_ssize_t
+_bufferedwriter_writev(buffered *self, struct iovec *iov, int iovcnt)
 {
-    PyObject *res = NULL;
-    Py_ssize_t written, avail, remaining;
-    Py_off_t offset;
-
-    CHECK_INITIALIZED(self)
-
-    if (!ENTER_BUFFERED(self))
-        return NULL;
+    Py_ssize_t pending = 0, written = 0, n;
+    int first = 1;
 
-    /* Issue #31976: Check for closed file after acquiring the lock. Another
-       thread could be holding the lock while closing the file. */
-    if (IS_CLOSED(self)) {
-        PyErr_SetString(PyExc_ValueError, "write to closed file");
-        goto error;
+    assert(CAN_WRITEV(self));
+    if (VALID_WRITE_BUFFER(self) && self->write_end > self->write_pos) {
+        pending = Py_SAFE_DOWNCAST(self->write_end - self->write_pos,
+                                   Py_off_t, Py_ssize_t);
+        iov[0].iov_base = self->buffer + self->write_pos;
+        iov[0].iov_len = (size_t)pending;
+        first = 0;
+    }
+    while (first < iovcnt) {
+        n = _PyFileIO_writev(self->raw, iov + first, iovcnt - first);
+        if (n == -1) {
+            return -1;
+        }
+        if (n == -2) {
+            break;
+        }
+        if (self->abs_pos != -1) {
+            self->abs_pos += n;
+        }
+        if (pending > 0) {
+            Py_ssize_t k = Py_MIN(n, pending);
+            self->write_pos += k;
+            self->raw_pos = self->write_pos;
+            pending -= k;
+            written += n - k;
+        }
+        else {
+            written += n;
+        }
+        /* Skip what was written */
+        while (first < iovcnt && (size_t)n >= iov[first].iov_len) {
+            n -= iov[first].iov_len;
+            first++;
+        }
+        if (n > 0) {
+            iov[first].iov_base = (char *)iov[first].iov_base + n;
+            iov[first].iov_len -= n;
+        }
+        /* Partial writes can return successfully when interrupted by a
+           signal (see write(2)).  We must run signal handlers before
+           blocking another time, possibly indefinitely. */
+        if (PyErr_CheckSignals() < 0) {
+            return -1;
+        }
     }
+    if (pending == 0) {
+        _bufferedwriter_reset_buf(self);
+        if (self->readable) {
+            _bufferedreader_reset_buf(self);
+        }
+        self->pos = 0;
+        self->raw_pos = 0;
+    }
+    return written;
+}
+#endif /* HAVE_WRITEV */
+
+/* Write len bytes from buf.  Return the number of bytes written, or -1 with
+   an exception set.  The lock must be held and the file must be open. */
+static Py_ssize_t
+_bufferedwriter_write_unlocked(buffered *self, const char *buf, Py_ssize_t len)
+{
+    PyObject *res;
+    Py_ssize_t written, avail, remaining, done = 0;
+    Py_off_t offset;
 
     /* Fast path: the data to write can be fully buffered. */
     if (!VALID_READ_BUFFER(self) && !VALID_WRITE_BUFFER(self)) {
@@ -1925,24 +1994,40 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
         self->raw_pos = 0;
     }
     avail = Py_SAFE_DOWNCAST(self->buffer_size - self->pos, Py_off_t, Py_ssize_t);
-    if (buffer->len <= avail) {
-        memcpy(self->buffer + self->pos, buffer->buf, buffer->len);
+    if (len <= avail) {
+        memcpy(self->buffer + self->pos, buf, len);
         if (!VALID_WRITE_BUFFER(self) || self->write_pos > self->pos) {
             self->write_pos = self->pos;
         }
-        ADJUST_POSITION(self, self->pos + buffer->len);
+        ADJUST_POSITION(self, self->pos + len);
         if (self->pos > self->write_end)
             self->write_end = self->pos;
-        written = buffer->len;
-        goto end;
+        return len;
+    }
+
+#ifdef HAVE_WRITEV
+    /* Write the current buffer and buf with a single system call. */
+    if (CAN_WRITEV(self)) {
+        struct iovec iov[2];
+        iov[1].iov_base = (void *)buf;
+        iov[1].iov_len = (size_t)len;
+        done = _bufferedwriter_writev(self, iov, 2);
+        if (done < 0)
+            return -1;
+        if (done == len)
+            return len;
+        /* The raw stream would block: go on below with the rest */
+        buf += done;
+        len -= done;
     }
+#endif
 
     /* First write the current buffer */
     res = _bufferedwriter_flush_unlocked(self);
     if (res == NULL) {
         Py_ssize_t *w = _buffered_check_blocking_error();
         if (w == NULL)
-            goto error;
+            return -1;
         if (self->readable)
             _bufferedreader_reset_buf(self);
         /* Make some place by shifting the buffer. */
@@ -1956,27 +2041,26 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
         self->write_pos = 0;
         avail = Py_SAFE_DOWNCAST(self->buffer_size - self->write_end,
                                  Py_off_t, Py_ssize_t);
-        if (buffer->len <= avail) {
+        if (len <= avail) {
             /* Everything can be buffered */
             PyErr_Clear();
-            memcpy(self->buffer + self->write_end, buffer->buf, buffer->len);
-            self->write_end += buffer->len;
-            self->pos += buffer->len;
-            written = buffer->len;
-            goto end;
+            memcpy(self->buffer + self->write_end, buf, len);
+            self->write_end += len;
+            self->pos += len;
+            return done + len;
         }
         /* Buffer as much as possible. */
-        memcpy(self->buffer + self->write_end, buffer->buf, avail);
+        memcpy(self->buffer + self->write_end, buf, avail);
         self->write_end += avail;
         self->pos += avail;
         /* XXX Modifying the existing exception e using the pointer w
            will change e.characters_written but not e.args[2].
            Therefore we just replace with a new error. */
         _set_BlockingIOError("write could not complete without blocking",
-                             avail);
-        goto error;
+                             done + avail);
+        return -1;
     }
-    Py_CLEAR(res);
+    Py_DECREF(res);
 
     /* Adjust the raw stream position if it is away from the logical stream
        position. This happens if the read buffer has been filled but not
@@ -1987,31 +2071,31 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
     offset = RAW_OFFSET(self);
     if (offset != 0) {
         if (_buffered_raw_seek(self, -offset, 1) < 0)
-            goto error;
+            return -1;
         self->raw_pos -= offset;
     }
 
     /* Then write buf itself. At this point the buffer has been emptied. */
-    remaining = buffer->len;
+    remaining = len;
     written = 0;
     while (remaining > self->buffer_size) {
         Py_ssize_t n = _bufferedwriter_raw_write(
-            self, (char *) buffer->buf + written, buffer->len - written);
+            self, (char *) buf + written, len - written);
         if (n == -1) {
-            goto error;
+            return -1;
         } else if (n == -2) {
             /* Write failed because raw file is non-blocking */
             if (remaining > self->buffer_size) {
                 /* Can't buffer everything, still buffer as much as possible */
                 memcpy(self->buffer,
-                       (char *) buffer->buf + written, self->buffer_size);
+                       (char *) buf + written, self->buffer_size);
                 self->raw_pos = 0;
                 ADJUST_POSITION(self, self->buffer_size);
                 self->write_end = self->buffer_size;
                 written += self->buffer_size;
                 _set_BlockingIOError("write could not complete without "
-                                     "blocking", written);
-                goto error;
+                                     "blocking", done + written);
+                return -1;
             }
             PyErr_Clear();
             break;
@@ -2022,12 +2106,12 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
            signal (see write(2)).  We must run signal handlers before
            blocking another time, possibly indefinitely. */
         if (PyErr_CheckSignals() < 0)
-            goto error;
+            return -1;
     }
     if (self->readable)
         _bufferedreader_reset_buf(self);
     if (remaining > 0) {
-        memcpy(self->buffer, (char *) buffer->buf + written, remaining);
+        memcpy(self->buffer, (char *) buf + written, remaining);
         written += remaining;
     }
     self->write_pos = 0;
@@ -2036,14 +2120,189 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
     ADJUST_POSITION(self, remaining);
     self->raw_pos = 0;
 
-end:
-    res = PyLong_FromSsize_t(written);
+    return done + written;
+}
+
+/*[clinic input]
+_io.BufferedWriter.write
+    buffer: Py_buffer
+    /
+[clinic start generated code]*/
+
+static PyObject *
+_io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
+/*[clinic end generated code: output=7f8d1365759bfc6b input=dd87dd85fc7f8850]*/
+{
+    PyObject *res = NULL;
+    Py_ssize_t written;
+
+    CHECK_INITIALIZED(self)
+
+    if (!ENTER_BUFFERED(self))
+        return NULL;
+
+    /* Issue #31976: Check for closed file after acquiring the lock. Another
+       thread could be holding the lock while closing the file. */
+    if (IS_CLOSED(self)) {
+        PyErr_SetString(PyExc_ValueError, "write to closed file");
+        goto error;
+    }
+
+    written = _bufferedwriter_write_unlocked(self, buffer->buf, buffer->len);
+    if (written >= 0)
+        res = PyLong_FromSsize_t(written);
 
 error:
     LEAVE_BUFFERED(self)
     return res;
 }
-
+
+/* Number of lines writelines() collects before writing them */
+#define WRITELINES_BATCH 64
+
+/* Write the count buffers of bufs.  Return 0 on success, or -1 with an
+   exception set.  The lock must be held and the file must be open. */
+static int
+_bufferedwriter_write_batch_unlocked(buffered *self,
+                                     Py_buffer *bufs, Py_ssize_t count)
+{
+    Py_ssize_t i, skip = 0;
+
+#ifdef HAVE_WRITEV
+    Py_ssize_t total = 0;
+    for (i = 0; i < count; i++) {
+        total += bufs[i].len;
+    }
+    if (!VALID_READ_BUFFER(self) && !VALID_WRITE_BUFFER(self)) {
+        self->pos = 0;
+        self->raw_pos = 0;
+    }
+    /* Lines which all fit in the buffer are copied to it below, the others
+       are written together with the buffer contents. */
+    if (total > self->buffer_size - self->pos && CAN_WRITEV(self)) {
+        struct iovec iov[WRITELINES_BATCH + 1];
+        for (i = 0; i < count; i++) {
+            iov[i + 1].iov_base = bufs[i].buf;
+            iov[i + 1].iov_len = (size_t)bufs[i].len;
+        }
+        skip = _bufferedwriter_writev(self, iov, (int)count + 1);
+        if (skip < 0)
+            return -1;
+    }
+#endif
+    for (i = 0; i < count; i++) {
+        const char *buf = bufs[i].buf;
+        Py_ssize_t len = bufs[i].len;
+        if (skip >= len) {
+            skip -= len;
+            continue;
+        }
+        if (_bufferedwriter_write_unlocked(self, buf + skip, len - skip) < 0)
+            return -1;
+        skip = 0;
+    }
+    return 0;
+}
+
+/*[clinic input]
+_io.BufferedWriter.writelines
+    lines: object
+    /
+
+Write an iterable of bytes-like objects to the stream.
+
+Lines which do not fit in the buffer are written along with the buffered
+data, using a single system call when possible.
+[clinic start generated code]*/
+
+static PyObject *
+_io_BufferedWriter_writelines(buffered *self, PyObject *lines)
+/*[clinic end generated code: output=7566d221eb1717a5 input=0416e94800e7877c]*/
+{
+    Py_buffer bufs[WRITELINES_BATCH];
+    Py_ssize_t count = 0, size = 0, i;
+    PyObject *iter, *item;
+    int res = -1;
+    /* Subclasses may override write() */
+    int batch = (Py_IS_TYPE(self, &PyBufferedWriter_Type) ||
+                 Py_IS_TYPE(self, &PyBufferedRandom_Type));
+
+    CHECK_INITIALIZED(self)
+    if (IS_CLOSED(self)) {
+        PyErr_SetString(PyExc_ValueError, "write to closed file");
+        return NULL;
+    }
+
+    iter = PyObject_GetIter(lines);
+    if (iter == NULL)
+        return NULL;
+
+    while (1) {
+        item = PyIter_Next(iter);
+        if (item == NULL) {
+            if (PyErr_Occurred())
+                goto end;
+        }
+        else if (!batch) {
+            PyObject *r;
+            do {
+                r = PyObject_CallMethodOneArg((PyObject *)self,
+                                              &_Py_ID(write), item);
+            } while (r == NULL && _PyIO_trap_eintr());
+            Py_DECREF(item);
+            if (r == NULL)
+                goto end;
+            Py_DECREF(r);
+            continue;
+        }
+        else {
+            if (PyObject_GetBuffer(item, &bufs[count], PyBUF_SIMPLE) < 0) {
+                Py_DECREF(item);
+                goto end;
+            }
+            /* The iterator may modify or resize a mutable buffer once it
+               is advanced, so such a line is written right away. */
+            int immutable = PyBytes_CheckExact(item);
+            Py_DECREF(item);
+            size += bufs[count].len;
+            count++;
+            /* Collect bytes lines until they fill the buffer */
+            if (immutable && count < WRITELINES_BATCH &&
+                size < self->buffer_size)
+                continue;
+        }
+        if (count > 0) {
+            int r;
+            if (!ENTER_BUFFERED(self))
+                goto end;
+            if (IS_CLOSED(self)) {
+                PyErr_SetString(PyExc_ValueError, "write to closed file");
+                r = -1;
+            }
+            else {
+                r = _bufferedwriter_write_batch_unlocked(self, bufs, count);
+            }
+            LEAVE_BUFFERED(self)
+            if (r < 0)
+                goto end;
+            for (i = 0; i < count; i++)
+                PyBuffer_Release(&bufs[i]);
+            count = 0;
+            size = 0;
+        }
+        if (item == NULL)
+            break;
+    }
+    res = 0;
+
+end:
+    for (i = 0; i < count; i++)
+        PyBuffer_Release(&bufs[i]);
+    Py_DECREF(iter);
+    if (res < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
 
 
 /*
@@ -2469,6 +2728,7 @@ static PyMethodDef bufferedwriter_methods[] = {
     {"_dealloc_warn", (PyCFunction)buffered_dealloc_warn, METH_O},
 
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO_BUFFEREDWRITER_WRITELINES_METHODDEF
     _IO__BUFFERED_TRUNCATE_METHODDEF
     {"flush", (PyCFunction)buffered_flush, METH_NOARGS},
     _IO__BUFFERED_SEEK_METHODDEF
@@ -2644,6 +2904,7 @@ static PyMethodDef bufferedrandom_methods[] = {
     _IO__BUFFERED_READLINE_METHODDEF
     _IO__BUFFERED_PEEK_METHODDEF
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO_BUFFEREDWRITER_WRITELINES_METHODDEF
     {"__sizeof__", (PyCFunction)buffered_sizeof, METH_NOARGS},
     {NULL, NULL}
 };
@@ -579,6 +579,18 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_io_BufferedWriter_writelines__doc__,
+"writelines($self, lines, /)\n"
+"--\n"
+"\n"
+"Write an iterable of bytes-like objects to the stream.\n"
+"\n"
+"Lines which do not fit in the buffer are written along with the buffered\n"
+"data, using a single system call when possible.");
+
+#define _IO_BUFFEREDWRITER_WRITELINES_METHODDEF    \
+    {"writelines", (PyCFunction)_io_BufferedWriter_writelines, METH_O, _io_BufferedWriter_writelines__doc__},
+
 PyDoc_STRVAR(_io_BufferedRWPair___init____doc__,
 "BufferedRWPair(reader, writer, buffer_size=DEFAULT_BUFFER_SIZE, /)\n"
 "--\n"
@@ -713,4 +725,4 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=ca87adcfff6a810b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=740641f17ad8700f input=a9049054013a1b77]*/
@@ -463,7 +463,29 @@ _io_FileIO_isatty(fileio *self, PyObject *Py_UNUSED(ignored))
     return _io_FileIO_isatty_impl(self);
 }
 
+PyDoc_STRVAR(_io_FileIO__isatty_open_only__doc__,
+"_isatty_open_only($self, /)\n"
+"--\n"
+"\n"
+"Checks whether the file is a TTY using an open-only optimization.\n"
+"\n"
+"A file which was a regular file when opened cannot be a TTY, so the\n"
+"system call can be skipped.  Only valid right after the file was opened,\n"
+"since the file descriptor may be reassigned later.");
+
+#define _IO_FILEIO__ISATTY_OPEN_ONLY_METHODDEF    \
+    {"_isatty_open_only", (PyCFunction)_io_FileIO__isatty_open_only, METH_NOARGS, _io_FileIO__isatty_open_only__doc__},
+
+static PyObject *
+_io_FileIO__isatty_open_only_impl(fileio *self);
+
+static PyObject *
+_io_FileIO__isatty_open_only(fileio *self, PyObject *Py_UNUSED(ignored))
+{
+    return _io_FileIO__isatty_open_only_impl(self);
+}
+
 #ifndef _IO_FILEIO_TRUNCATE_METHODDEF
     #define _IO_FILEIO_TRUNCATE_METHODDEF
 #endif /* !defined(_IO_FILEIO_TRUNCATE_METHODDEF) */
-/*[clinic end generated code: output=27f883807a6c29ae input=a9049054013a1b77]*/
+/*[clinic end generated code: output=064fcb0b7ca10f8a input=a9049054013a1b77]*/
@@ -12,6 +12,9 @@
 #ifdef HAVE_SYS_STAT_H
 #include <sys/stat.h>
 #endif
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
 #ifdef HAVE_IO_H
 #include <io.h>
 #endif
@@ -49,6 +52,9 @@
 #define SMALLCHUNK BUFSIZ
 #endif
 
+/* readall() trusts the size found at open for files smaller than this */
+#define SMALL_FILE_SIZE (64*1024)
+
 /*[clinic input]
 module _io
 class _io.FileIO "fileio *" "&PyFileIO_Type"
@@ -64,8 +70,12 @@ typedef struct {
     unsigned int appending : 1;
     signed int seekable : 2; /* -1 means unknown */
     unsigned int closefd : 1;
+    unsigned int regular : 1; /* regular file according to fstat() at open */
     char finalizing;
     unsigned int blksize;
+    /* Size of the file according to fstat() at open, -1 if unknown.  Only
+       used as a hint to size the buffer of readall(). */
+    Py_off_t estimated_size;
     PyObject *weakreflist;
     PyObject *dict;
 } fileio;
@@ -184,6 +194,8 @@ fileio_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         self->seekable = -1;
         self->blksize = 0;
         self->closefd = 1;
+        self->regular = 0;
+        self->estimated_size = -1;
         self->weakreflist = NULL;
     }
 
@@ -459,6 +471,10 @@ _io_FileIO___init___impl(fileio *self, PyObject *nameobj, const char *mode,
         if (fdfstat.st_blksize > 1)
             self->blksize = fdfstat.st_blksize;
 #endif /* HAVE_STRUCT_STAT_ST_BLKSIZE */
+        if (S_ISREG(fdfstat.st_mode)) {
+            self->regular = 1;
+            self->estimated_size = fdfstat.st_size;
+        }
     }
 
 #if defined(MS_WINDOWS) || defined(__CYGWIN__)
@@ -544,6 +560,47 @@ err_mode(const char *action)
     return NULL;
 }
 
+#ifdef HAVE_WRITEV
+Py_ssize_t
+_PyFileIO_writev(PyObject *op, const struct iovec *iov, int iovcnt)
+{
+    fileio *self = (fileio *)op;
+    Py_ssize_t n;
+    int err, async_err = 0;
+
+    if (self->fd < 0) {
+        err_closed();
+        return -1;
+    }
+    if (!self->writable) {
+        err_mode("writing");
+        return -1;
+    }
+    self->estimated_size = -1;
+
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        errno = 0;
+        n = writev(self->fd, iov, iovcnt);
+        err = errno;
+        Py_END_ALLOW_THREADS
+    } while (n < 0 && err == EINTR && !(async_err = PyErr_CheckSignals()));
+
+    if (async_err) {
+        return -1;
+    }
+    if (n < 0) {
+        if (err == EAGAIN) {
+            return -2;
+        }
+        errno = err;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return n;
+}
+#endif
+
 /*[clinic input]
 _io.FileIO.fileno
 
@@ -693,21 +750,32 @@ _io_FileIO_readall_impl(fileio *self)
     if (self->fd < 0)
         return err_closed();
 
-    Py_BEGIN_ALLOW_THREADS
-    _Py_BEGIN_SUPPRESS_IPH
+    end = self->estimated_size;
+    if (end > 0 && end < SMALL_FILE_SIZE) {
+        /* The size found by fstat() at open is small enough that
+           over-allocating by the current position is cheaper than
+           the two system calls needed to compute the exact size.  The
+           buffer is shrunk (or grown) below if the estimate was wrong. */
+        pos = 0;
+    }
+    else {
+        Py_BEGIN_ALLOW_THREADS
+        _Py_BEGIN_SUPPRESS_IPH
 #ifdef MS_WINDOWS
-    pos = _lseeki64(self->fd, 0L, SEEK_CUR);
+        pos = _lseeki64(self->fd, 0L, SEEK_CUR);
 #else
-    pos = lseek(self->fd, 0L, SEEK_CUR);
+        pos = lseek(self->fd, 0L, SEEK_CUR);
 #endif
-    _Py_END_SUPPRESS_IPH
-    fstat_result = _Py_fstat_noraise(self->fd, &status);
-    Py_END_ALLOW_THREADS
-
-    if (fstat_result == 0)
-        end = status.st_size;
-    else
-        end = (Py_off_t)-1;
+        _Py_END_SUPPRESS_IPH
+        if (end <= 0) {
+            fstat_result = _Py_fstat_noraise(self->fd, &status);
+            if (fstat_result == 0)
+                end = status.st_size;
+            else
+                end = (Py_off_t)-1;
+        }
+        Py_END_ALLOW_THREADS
+    }
 
     if (end > 0 && end >= pos && pos >= 0 && end - pos < PY_SSIZE_T_MAX) {
         /* This is probably a real file, so we try to allocate a
@@ -851,6 +919,9 @@ _io_FileIO_write_impl(fileio *self, Py_buffer *b)
     if (!self->writable)
         return err_mode("writing");
 
+    /* The file size found at open is now unreliable */
+    self->estimated_size = -1;
+
     n = _Py_write(self->fd, b->buf, b->len);
     /* copy errno because PyBuffer_Release() can indirectly modify it */
     err = errno;
@@ -1002,6 +1073,7 @@ _io_FileIO_truncate_impl(fileio *self, PyObject *posobj)
         return err_closed();
     if (!self->writable)
         return err_mode("writing");
+    self->estimated_size = -1;
 
     if (posobj == Py_None) {
         /* Get the current position. */
@@ -1126,6 +1198,26 @@ _io_FileIO_isatty_impl(fileio *self)
     return PyBool_FromLong(res);
 }
 
+/*[clinic input]
+_io.FileIO._isatty_open_only
+
+Checks whether the file is a TTY using an open-only optimization.
+
+A file which was a regular file when opened cannot be a TTY, so the
+system call can be skipped.  Only valid right after the file was opened,
+since the file descriptor may be reassigned later.
+[clinic start generated code]*/
+
+static PyObject *
+_io_FileIO__isatty_open_only_impl(fileio *self)
+/*[clinic end generated code: output=2b4689154d4b8b84 input=880f0ef9e499f487]*/
+{
+    if (self->fd >= 0 && self->regular) {
+        Py_RETURN_FALSE;
+    }
+    return _io_FileIO_isatty_impl(self);
+}
+
 #include "clinic/fileio.c.h"
 
 static PyMethodDef fileio_methods[] = {
@@ -1142,6 +1234,7 @@ static PyMethodDef fileio_methods[] = {
     _IO_FILEIO_WRITABLE_METHODDEF
     _IO_FILEIO_FILENO_METHODDEF
     _IO_FILEIO_ISATTY_METHODDEF
+    _IO_FILEIO__ISATTY_OPEN_ONLY_METHODDEF
     {"_dealloc_warn", (PyCFunction)fileio_dealloc_warn, METH_O, NULL},
     {NULL,           NULL}             /* sentinel */
 };
@@ -2030,6 +2030,22 @@ _PyIO_find_line_ending(
          * The decoder ensures that \r\n are not split in two pieces
          */
         const char *s = start;
+        if (kind == PyUnicode_1BYTE_KIND) {
+            /* Let the libc's optimized memchr() find the first \n, then
+               look for a \r only in front of it, so that a long run of
+               text without \r is not scanned more than twice. */
+            const char *lf = memchr(s, '\n', end - s);
+            const char *cr = memchr(s, '\r', (lf != NULL ? lf : end) - s);
+            if (cr != NULL) {
+                if (cr + 1 < end && cr[1] == '\n')
+                    return (cr - start) + 2;
+                return (cr - start) + 1;
+            }
+            if (lf != NULL)
+                return (lf - start) + 1;
+            *consumed = len;
+            return -1;
+        }
         for (;;) {
             Py_UCS4 ch;
             /* Fast path for non-control chars. The loop always ends
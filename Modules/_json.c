@@ -25,6 +25,8 @@ typedef struct _PyScannerObject {
     PyObject *parse_int;
     PyObject *parse_constant;
     PyObject *memo;
+    PyObject *shapes;
+    Py_ssize_t depth;
 } PyScannerObject;
 
 static PyMemberDef scanner_members[] = {
@@ -646,6 +648,7 @@ scanner_traverse(PyScannerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->parse_int);
     Py_VISIT(self->parse_constant);
     Py_VISIT(self->memo);
+    Py_VISIT(self->shapes);
     return 0;
 }
 
@@ -658,9 +661,89 @@ scanner_clear(PyScannerObject *self)
     Py_CLEAR(self->parse_int);
     Py_CLEAR(self->parse_constant);
     Py_CLEAR(self->memo);
+    Py_CLEAR(self->shapes);
     return 0;
 }
 
+static int
+_is_shape_key(PyObject *key)
+{
+    /* Return 1 if key can only be spelled one way in JSON, i.e. it contains
+       no character that has to be escaped. */
+    int kind = PyUnicode_KIND(key);
+    const void *data = PyUnicode_DATA(key);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(key);
+    for (Py_ssize_t i = 0; i < len; i++) {
+        Py_UCS4 c = PyUnicode_READ(kind, data, i);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static Py_ssize_t
+_match_shape_key(PyObject *key, int kind, const void *str, Py_ssize_t idx,
+                 Py_ssize_t end_idx)
+{
+    /* Check whether the JSON string starting at idx (the first character
+       after the opening quote) spells key.  key is either None or a string
+       accepted by _is_shape_key().
+
+       Returns the index of the first character after the closing quote,
+       or -1 if the string does not match.
+    */
+    Py_ssize_t len, i;
+    int key_kind;
+    const void *key_data;
+
+    if (key == Py_None) {
+        return -1;
+    }
+    len = PyUnicode_GET_LENGTH(key);
+    if (len > end_idx - idx) {
+        return -1;
+    }
+    key_kind = PyUnicode_KIND(key);
+    key_data = PyUnicode_DATA(key);
+    if (key_kind == kind) {
+        if (memcmp((const char *)str + idx * kind, key_data, len * kind) != 0) {
+            return -1;
+        }
+    }
+    else {
+        for (i = 0; i < len; i++) {
+            if (PyUnicode_READ(kind, str, idx + i) !=
+                PyUnicode_READ(key_kind, key_data, i)) {
+                return -1;
+            }
+        }
+    }
+    if (PyUnicode_READ(kind, str, idx + len) != '"') {
+        return -1;
+    }
+    return idx + len + 1;
+}
+
+static int
+_store_shape(PyScannerObject *s, Py_ssize_t depth, PyObject *shape)
+{
+    /* Remember shape as the key sequence of the last object decoded at the
+       given nesting depth.  Steals a reference to shape. */
+    while (PyList_GET_SIZE(s->shapes) < depth) {
+        if (PyList_Append(s->shapes, Py_None) < 0) {
+            Py_DECREF(shape);
+            return -1;
+        }
+    }
+    if (depth < PyList_GET_SIZE(s->shapes)) {
+        return PyList_SetItem(s->shapes, depth, shape);
+    }
+    int res = PyList_Append(s->shapes, shape);
+    Py_DECREF(shape);
+    return res;
+}
+
 static PyObject *
 _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
 {
@@ -670,6 +753,12 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
         the closing curly brace.
 
     Returns a new PyObject (usually a dict, but object_hook can change that)
+
+    Objects decoded in a row at the same nesting depth (typically the records
+    of an array) tend to have the same keys in the same order.  The keys of
+    the previous object at this depth are kept in s->shapes and are matched
+    against the input directly, so that a repeated key is neither decoded nor
+    looked up in the memo again, and the dict can be presized.
     */
     const void *str;
     int kind;
@@ -677,6 +766,11 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     PyObject *val = NULL;
     PyObject *rval = NULL;
     PyObject *key = NULL;
+    PyObject *shape = NULL;
+    PyObject *new_shape = NULL;
+    Py_ssize_t nshape = 0;
+    Py_ssize_t nkeys = 0;
+    Py_ssize_t depth;
     int has_pairs_hook = (s->object_pairs_hook != Py_None);
     Py_ssize_t next_idx;
 
@@ -687,12 +781,26 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     kind = PyUnicode_KIND(pystr);
     end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
 
+    depth = s->depth;
+    if (depth < PyList_GET_SIZE(s->shapes)) {
+        shape = PyList_GET_ITEM(s->shapes, depth);
+        if (shape == Py_None) {
+            shape = NULL;
+        }
+        else {
+            /* object_hook may run a nested decode which clears s->shapes */
+            Py_INCREF(shape);
+            nshape = PyList_GET_SIZE(shape);
+        }
+    }
+
     if (has_pairs_hook)
         rval = PyList_New(0);
     else
-        rval = PyDict_New();
+        rval = _PyDict_NewPresized(nshape);
     if (rval == NULL)
-        return NULL;
+        goto bail;
+    s->depth = depth + 1;
 
     /* skip whitespace after { */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind,str, idx))) idx++;
@@ -707,14 +815,42 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
                 raise_errmsg("Expecting property name enclosed in double quotes", pystr, idx);
                 goto bail;
             }
-            key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
-            if (key == NULL)
-                goto bail;
-            memokey = PyDict_SetDefault(s->memo, key, key);
-            if (memokey == NULL) {
+            if (new_shape == NULL && nkeys < nshape) {
+                PyObject *expected = PyList_GET_ITEM(shape, nkeys);
+                next_idx = _match_shape_key(expected, kind, str, idx + 1, end_idx);
+                if (next_idx >= 0) {
+                    key = Py_NewRef(expected);
+                }
+            }
+            if (key == NULL) {
+                key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
+                if (key == NULL)
+                    goto bail;
+                memokey = PyDict_SetDefault(s->memo, key, key);
+                if (memokey == NULL) {
+                    goto bail;
+                }
+                Py_SETREF(key, Py_NewRef(memokey));
+                /* the object diverges from the shape: record a new one */
+                if (new_shape == NULL) {
+                    if (shape != NULL) {
+                        new_shape = PyList_GetSlice(shape, 0, nkeys);
+                    }
+                    else {
+                        new_shape = PyList_New(0);
+                    }
+                    if (new_shape == NULL) {
+                        goto bail;
+                    }
+                }
+            }
+            if (new_shape != NULL &&
+                PyList_Append(new_shape,
+                              _is_shape_key(key) ? key : Py_None) < 0)
+            {
                 goto bail;
             }
-            Py_SETREF(key, Py_NewRef(memokey));
+            nkeys++;
             idx = next_idx;
 
             /* skip whitespace between key and : delimiter, read :, skip whitespace */
@@ -769,6 +905,22 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     }
 
     *next_idx_ptr = idx + 1;
+    s->depth = depth;
+
+    if (new_shape == NULL && nkeys < nshape && nkeys > 0) {
+        new_shape = PyList_GetSlice(shape, 0, nkeys);
+        if (new_shape == NULL) {
+            goto bail;
+        }
+    }
+    Py_CLEAR(shape);
+    if (new_shape != NULL) {
+        int res = _store_shape(s, depth, new_shape);
+        new_shape = NULL;
+        if (res < 0) {
+            goto bail;
+        }
+    }
 
     if (has_pairs_hook) {
         val = PyObject_CallOneArg(s->object_pairs_hook, rval);
@@ -784,9 +936,12 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     }
     return rval;
 bail:
+    s->depth = depth;
     Py_XDECREF(key);
     Py_XDECREF(val);
     Py_XDECREF(rval);
+    Py_XDECREF(shape);
+    Py_XDECREF(new_shape);
     return NULL;
 }
 
@@ -1142,6 +1297,10 @@ scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
     PyDict_Clear(self->memo);
+    if (PyList_SetSlice(self->shapes, 0, PY_SSIZE_T_MAX, NULL) < 0) {
+        Py_XDECREF(rval);
+        return NULL;
+    }
     if (rval == NULL)
         return NULL;
     return _build_rval_index_tuple(rval, next_idx);
@@ -1166,6 +1325,9 @@ scanner_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     s->memo = PyDict_New();
     if (s->memo == NULL)
         goto bail;
+    s->shapes = PyList_New(0);
+    if (s->shapes == NULL)
+        goto bail;
 
     /* All of these will fail "gracefully" so we don't need to verify them */
     strict = PyObject_GetAttrString(ctx, "strict");
@@ -165,6 +165,270 @@ exit:
 
 #endif /* defined(HAVE_SHM_UNLINK) */
 
+#if defined(HAVE_SHM_RING)
+
+PyDoc_STRVAR(_posixshmem_ring_init__doc__,
+"ring_init($module, buffer, /)\n"
+"--\n"
+"\n"
+"Initialize a ring buffer in a writable buffer.\n"
+"\n"
+"Returns the capacity of the ring buffer in bytes.");
+
+#define _POSIXSHMEM_RING_INIT_METHODDEF    \
+    {"ring_init", (PyCFunction)_posixshmem_ring_init, METH_O, _posixshmem_ring_init__doc__},
+
+static Py_ssize_t
+_posixshmem_ring_init_impl(PyObject *module, Py_buffer *buffer);
+
+static PyObject *
+_posixshmem_ring_init(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+    Py_ssize_t _return_value;
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("ring_init", "argument", "read-write bytes-like object", arg);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("ring_init", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    _return_value = _posixshmem_ring_init_impl(module, &buffer);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_SHM_RING) */
+
+#if defined(HAVE_SHM_RING)
+
+PyDoc_STRVAR(_posixshmem_ring_capacity__doc__,
+"ring_capacity($module, buffer, /)\n"
+"--\n"
+"\n"
+"Return the capacity in bytes of the ring buffer held by a buffer.");
+
+#define _POSIXSHMEM_RING_CAPACITY_METHODDEF    \
+    {"ring_capacity", (PyCFunction)_posixshmem_ring_capacity, METH_O, _posixshmem_ring_capacity__doc__},
+
+static Py_ssize_t
+_posixshmem_ring_capacity_impl(PyObject *module, Py_buffer *buffer);
+
+static PyObject *
+_posixshmem_ring_capacity(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+    Py_ssize_t _return_value;
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("ring_capacity", "argument", "read-write bytes-like object", arg);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("ring_capacity", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    _return_value = _posixshmem_ring_capacity_impl(module, &buffer);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_SHM_RING) */
+
+#if defined(HAVE_SHM_RING)
+
+PyDoc_STRVAR(_posixshmem_ring_put__doc__,
+"ring_put($module, buffer, parts, timeout=None, /)\n"
+"--\n"
+"\n"
+"Append a message to a ring buffer.\n"
+"\n"
+"The message is the concatenation of the bytes-like objects in the\n"
+"sequence *parts*.  Wait for enough free space in the ring buffer, for at\n"
+"most *timeout* seconds unless it is None.  Return False if the timeout\n"
+"expired, True otherwise.");
+
+#define _POSIXSHMEM_RING_PUT_METHODDEF    \
+    {"ring_put", _PyCFunction_CAST(_posixshmem_ring_put), METH_FASTCALL, _posixshmem_ring_put__doc__},
+
+static PyObject *
+_posixshmem_ring_put_impl(PyObject *module, Py_buffer *buffer,
+                          PyObject *parts, PyObject *timeout);
+
+static PyObject *
+_posixshmem_ring_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+    PyObject *parts;
+    PyObject *timeout = Py_None;
+
+    if (!_PyArg_CheckPositional("ring_put", nargs, 2, 3)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("ring_put", "argument 1", "read-write bytes-like object", args[0]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("ring_put", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    parts = args[1];
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    timeout = args[2];
+skip_optional:
+    return_value = _posixshmem_ring_put_impl(module, &buffer, parts, timeout);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_SHM_RING) */
+
+#if defined(HAVE_SHM_RING)
+
+PyDoc_STRVAR(_posixshmem_ring_get__doc__,
+"ring_get($module, buffer, timeout=None, /)\n"
+"--\n"
+"\n"
+"Remove the oldest message from a ring buffer and return it as bytes.\n"
+"\n"
+"Wait for a message, for at most *timeout* seconds unless it is None.\n"
+"Return None if the timeout expired.");
+
+#define _POSIXSHMEM_RING_GET_METHODDEF    \
+    {"ring_get", _PyCFunction_CAST(_posixshmem_ring_get), METH_FASTCALL, _posixshmem_ring_get__doc__},
+
+static PyObject *
+_posixshmem_ring_get_impl(PyObject *module, Py_buffer *buffer,
+                          PyObject *timeout);
+
+static PyObject *
+_posixshmem_ring_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+    PyObject *timeout = Py_None;
+
+    if (!_PyArg_CheckPositional("ring_get", nargs, 1, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("ring_get", "argument 1", "read-write bytes-like object", args[0]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("ring_get", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    timeout = args[1];
+skip_optional:
+    return_value = _posixshmem_ring_get_impl(module, &buffer, timeout);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_SHM_RING) */
+
+#if defined(HAVE_SHM_RING)
+
+PyDoc_STRVAR(_posixshmem_ring_poll__doc__,
+"ring_poll($module, buffer, timeout=None, /)\n"
+"--\n"
+"\n"
+"Return whether a message is available in a ring buffer.\n"
+"\n"
+"Wait for a message, for at most *timeout* seconds unless it is None.");
+
+#define _POSIXSHMEM_RING_POLL_METHODDEF    \
+    {"ring_poll", _PyCFunction_CAST(_posixshmem_ring_poll), METH_FASTCALL, _posixshmem_ring_poll__doc__},
+
+static PyObject *
+_posixshmem_ring_poll_impl(PyObject *module, Py_buffer *buffer,
+                           PyObject *timeout);
+
+static PyObject *
+_posixshmem_ring_poll(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+    PyObject *timeout = Py_None;
+
+    if (!_PyArg_CheckPositional("ring_poll", nargs, 1, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("ring_poll", "argument 1", "read-write bytes-like object", args[0]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("ring_poll", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    timeout = args[1];
+skip_optional:
+    return_value = _posixshmem_ring_poll_impl(module, &buffer, timeout);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_SHM_RING) */
+
 #ifndef _POSIXSHMEM_SHM_OPEN_METHODDEF
     #define _POSIXSHMEM_SHM_OPEN_METHODDEF
 #endif /* !defined(_POSIXSHMEM_SHM_OPEN_METHODDEF) */
@@ -172,4 +436,24 @@ exit:
 #ifndef _POSIXSHMEM_SHM_UNLINK_METHODDEF
     #define _POSIXSHMEM_SHM_UNLINK_METHODDEF
 #endif /* !defined(_POSIXSHMEM_SHM_UNLINK_METHODDEF) */
-/*[clinic end generated code: output=3f6fee283d5fd0e9 input=a9049054013a1b77]*/
+
+#ifndef _POSIXSHMEM_RING_INIT_METHODDEF
+    #define _POSIXSHMEM_RING_INIT_METHODDEF
+#endif /* !defined(_POSIXSHMEM_RING_INIT_METHODDEF) */
+
+#ifndef _POSIXSHMEM_RING_CAPACITY_METHODDEF
+    #define _POSIXSHMEM_RING_CAPACITY_METHODDEF
+#endif /* !defined(_POSIXSHMEM_RING_CAPACITY_METHODDEF) */
+
+#ifndef _POSIXSHMEM_RING_PUT_METHODDEF
+    #define _POSIXSHMEM_RING_PUT_METHODDEF
+#endif /* !defined(_POSIXSHMEM_RING_PUT_METHODDEF) */
+
+#ifndef _POSIXSHMEM_RING_GET_METHODDEF
+    #define _POSIXSHMEM_RING_GET_METHODDEF
+#endif /* !defined(_POSIXSHMEM_RING_GET_METHODDEF) */
+
+#ifndef _POSIXSHMEM_RING_POLL_METHODDEF
+    #define _POSIXSHMEM_RING_POLL_METHODDEF
+#endif /* !defined(_POSIXSHMEM_RING_POLL_METHODDEF) */
+/*[clinic end generated code: output=1eacc4ca5791a36c input=a9049054013a1b77]*/
@@ -101,21 +101,688 @@ _posixshmem_shm_unlink_impl(PyObject *module, PyObject *path)
 }
 #endif /* HAVE_SHM_UNLINK */
 
+/*
+ * Ring buffer channel
+ *
+ * A ring buffer living in a shared memory block, used by
+ * multiprocessing.shared_memory.ShareableChannel to pass variable-length
+ * messages between processes without a pipe.  The block starts with a
+ * ring_header followed by the data area.  Each message is stored as a
+ * record: its length as a 64-bit integer followed by its payload, padded
+ * to a multiple of 8 bytes.  Payloads may wrap around the end of the data
+ * area; record lengths never do since the capacity is a multiple of 8.
+ *
+ * head and tail count the bytes ever written and read, so the ring is
+ * empty when they are equal.  Senders are serialized by send_lock and
+ * receivers by recv_lock, which makes the ring safe for any number of
+ * senders and receivers.  The lock holder is the only one to ever wait
+ * for space (or data), on the space_seq (or data_seq) counter, which is
+ * bumped by the other side after each record is read (or published).
+ *
+ * The locks hold the pid of their owner, so that a process dying while
+ * holding one does not block the channel forever: waiters check that
+ * the owner is still alive every RING_OWNER_CHECK_INTERVAL and one of
+ * them takes the lock over otherwise.  Since head (or tail) is only
+ * updated once a record has been copied, the ring stays consistent: the
+ * record being sent by the dead process is discarded, and the one it was
+ * receiving is either consumed or left for the next receiver.
+ *
+ * On Linux, the locks and the waits use futexes shared between processes;
+ * elsewhere they fall back to polling.
+ */
+
+#if defined(HAVE_BUILTIN_ATOMIC) && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) \
+    && __GCC_ATOMIC_LLONG_LOCK_FREE == 2
+#define HAVE_SHM_RING
+#endif
+
+#ifdef HAVE_SHM_RING
+
+#include <signal.h>               // kill()
+#include <stdint.h>
+#include <time.h>
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+
+#if defined(__linux__) && defined(HAVE_LINUX_FUTEX_H)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  ifdef SYS_futex
+#    define RING_USE_FUTEX
+#  endif
+#endif
+
+#define RING_MAGIC 0x31474e4952485350ULL    /* "PSHRING1" */
+#define RING_SPIN_COUNT 100
+/* Polling interval in nanoseconds when futexes are not available */
+#define RING_POLL_INTERVAL 50000
+/* Interval in nanoseconds between checks that a lock owner is alive */
+#define RING_OWNER_CHECK_INTERVAL 100000000L
+/* Flag set in a lock word when other processes may be waiting for it */
+#define RING_LOCK_WAITERS 0x80000000U
+
+typedef struct {
+    uint64_t magic;
+    uint64_t capacity;
+    char _pad0[48];
+    /* Written by senders */
+    uint64_t head;
+    uint32_t send_lock;
+    uint32_t data_seq;
+    uint32_t receivers_waiting;
+    char _pad1[44];
+    /* Written by receivers */
+    uint64_t tail;
+    uint32_t recv_lock;
+    uint32_t space_seq;
+    uint32_t senders_waiting;
+    char _pad2[44];
+} ring_header;
+
+static_assert(sizeof(ring_header) == 192, "unexpected ring_header size");
+
+#define RING_HEADER_SIZE ((Py_ssize_t)sizeof(ring_header))
+#define RING_DATA(h) ((char *)(h) + sizeof(ring_header))
+#define RING_RECORD_SIZE(n) (8 + (((uint64_t)(n) + 7) & ~(uint64_t)7))
+
+#define LOAD(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+
+typedef struct {
+    int infinite;
+    struct timespec end;    /* CLOCK_MONOTONIC */
+} ring_deadline;
+
+static int
+ring_deadline_init(ring_deadline *d, PyObject *timeout)
+{
+    if (timeout == Py_None) {
+        d->infinite = 1;
+        return 0;
+    }
+    double secs = PyFloat_AsDouble(timeout);
+    if (secs == -1.0 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (!(secs >= 0.0)) {
+        PyErr_SetString(PyExc_ValueError, "timeout must be a non-negative number");
+        return -1;
+    }
+    if (secs > (double)(INT_MAX)) {
+        d->infinite = 1;
+        return 0;
+    }
+    d->infinite = 0;
+    clock_gettime(CLOCK_MONOTONIC, &d->end);
+    long sec = (long)secs;
+    d->end.tv_sec += sec;
+    d->end.tv_nsec += (long)((secs - sec) * 1e9);
+    if (d->end.tv_nsec >= 1000000000L) {
+        d->end.tv_sec++;
+        d->end.tv_nsec -= 1000000000L;
+    }
+    return 0;
+}
+
+/* Store the time left before the deadline in *rel.  Return -1 if the
+   deadline has passed. */
+static int
+ring_deadline_remaining(const ring_deadline *d, struct timespec *rel)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    rel->tv_sec = d->end.tv_sec - now.tv_sec;
+    rel->tv_nsec = d->end.tv_nsec - now.tv_nsec;
+    if (rel->tv_nsec < 0) {
+        rel->tv_sec--;
+        rel->tv_nsec += 1000000000L;
+    }
+    if (rel->tv_sec < 0 || (rel->tv_sec == 0 && rel->tv_nsec == 0)) {
+        return -1;
+    }
+    return 0;
+}
+
+/* Set *slice to the earlier of deadline d and interval nanoseconds from
+   now.  Return 1 if that is d. */
+static int
+ring_deadline_slice(ring_deadline *slice, const ring_deadline *d,
+                    long interval)
+{
+    slice->infinite = 0;
+    clock_gettime(CLOCK_MONOTONIC, &slice->end);
+    slice->end.tv_nsec += interval;
+    while (slice->end.tv_nsec >= 1000000000L) {
+        slice->end.tv_sec++;
+        slice->end.tv_nsec -= 1000000000L;
+    }
+    if (d->infinite
+        || d->end.tv_sec > slice->end.tv_sec
+        || (d->end.tv_sec == slice->end.tv_sec
+            && d->end.tv_nsec > slice->end.tv_nsec))
+    {
+        return 0;
+    }
+    *slice = *d;
+    return 1;
+}
+
+/* Wait until *addr may have changed from val, or until the deadline.
+   Return 0 (which may be spurious), ETIMEDOUT or EINTR. */
+static int
+ring_wait(uint32_t *addr, uint32_t val, const ring_deadline *d)
+{
+    struct timespec rel, *prel = NULL;
+    if (!d->infinite) {
+        if (ring_deadline_remaining(d, &rel) < 0) {
+            return ETIMEDOUT;
+        }
+        prel = &rel;
+    }
+#ifdef RING_USE_FUTEX
+    /* Not FUTEX_PRIVATE_FLAG: the word is shared with other processes */
+    if (syscall(SYS_futex, addr, FUTEX_WAIT, val, prel, NULL, 0) < 0) {
+        if (errno == EINTR || errno == ETIMEDOUT) {
+            return errno;
+        }
+    }
+    return 0;
+#else
+    (void)addr;
+    (void)val;
+    struct timespec interval = {0, RING_POLL_INTERVAL};
+    if (prel != NULL && prel->tv_sec == 0 && prel->tv_nsec < interval.tv_nsec) {
+        interval = *prel;
+    }
+    if (nanosleep(&interval, NULL) < 0 && errno == EINTR) {
+        return EINTR;
+    }
+    return 0;
+#endif
+}
+
+static void
+ring_wake(uint32_t *addr)
+{
+#ifdef RING_USE_FUTEX
+    syscall(SYS_futex, addr, FUTEX_WAKE, 1, NULL, NULL, 0);
+#else
+    (void)addr;
+#endif
+}
+
+/* Return whether the process pid may still be alive. */
+static int
+ring_owner_alive(uint32_t pid)
+{
+#ifdef HAVE_KILL
+    /* EPERM means that the process exists but belongs to another user */
+    return kill((pid_t)pid, 0) == 0 || errno != ESRCH;
+#else
+    (void)pid;
+    return 1;
+#endif
+}
+
+/* Locks use the futex mutex algorithm, with the pid of the owner in place
+   of 1: 0 is unlocked, pid is locked and pid | RING_LOCK_WAITERS is locked
+   with possible waiters.  Return 0 with the lock held, EOWNERDEAD with the
+   lock taken over from a dead owner, or ETIMEDOUT or EINTR. */
+static int
+ring_lock(uint32_t *lock, const ring_deadline *d)
+{
+    uint32_t self = (uint32_t)getpid();
+    uint32_t c = 0;
+    if (__atomic_compare_exchange_n(lock, &c, self, 0,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return 0;
+    }
+    for (int i = 0; i < RING_SPIN_COUNT && !(c & RING_LOCK_WAITERS); i++) {
+#ifdef HAVE_SCHED_H
+        sched_yield();
+#endif
+        c = 0;
+        if (__atomic_compare_exchange_n(lock, &c, self, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return 0;
+        }
+    }
+    for (;;) {
+        if (c == 0) {
+            /* Others may still be waiting: keep the flag set */
+            if (__atomic_compare_exchange_n(lock, &c,
+                                            self | RING_LOCK_WAITERS, 0,
+                                            __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED)) {
+                return 0;
+            }
+            continue;
+        }
+        if (!(c & RING_LOCK_WAITERS)) {
+            if (!__atomic_compare_exchange_n(lock, &c, c | RING_LOCK_WAITERS,
+                                             0, __ATOMIC_RELAXED,
+                                             __ATOMIC_RELAXED)) {
+                continue;
+            }
+            c |= RING_LOCK_WAITERS;
+        }
+        ring_deadline slice;
+        int last = ring_deadline_slice(&slice, d, RING_OWNER_CHECK_INTERVAL);
+        int err = ring_wait(lock, c, &slice);
+        if (err == EINTR || (err == ETIMEDOUT && last)) {
+            return err;
+        }
+        if (err == ETIMEDOUT && !ring_owner_alive(c & ~RING_LOCK_WAITERS)) {
+            /* Only one of the waiters succeeds in taking the lock over */
+            if (__atomic_compare_exchange_n(lock, &c,
+                                            self | RING_LOCK_WAITERS, 0,
+                                            __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED)) {
+                return EOWNERDEAD;
+            }
+            continue;
+        }
+        c = LOAD(lock);
+    }
+}
+
+static void
+ring_unlock(uint32_t *lock)
+{
+    if (__atomic_exchange_n(lock, 0, __ATOMIC_RELEASE) & RING_LOCK_WAITERS) {
+        ring_wake(lock);
+    }
+}
+
+/* Acquire send_lock and wait until rec bytes are free.  Return 0 with the
+   lock held, or ETIMEDOUT or EINTR with the lock released. */
+static int
+ring_wait_space(ring_header *h, uint64_t rec, const ring_deadline *d)
+{
+    int err = ring_lock(&h->send_lock, d);
+    if (err == EOWNERDEAD) {
+        /* The previous sender may have died before waking receivers */
+        __atomic_add_fetch(&h->data_seq, 1, __ATOMIC_SEQ_CST);
+        ring_wake(&h->data_seq);
+    }
+    else if (err) {
+        return err;
+    }
+    uint64_t head = __atomic_load_n(&h->head, __ATOMIC_RELAXED);
+    for (int i = 0; ; i++) {
+        if (h->capacity - (head - LOAD(&h->tail)) >= rec) {
+            return 0;
+        }
+        if (i < RING_SPIN_COUNT) {
+            continue;
+        }
+        /* Announce ourselves before checking again, so that a receiver
+           freeing space in the meantime either sees us or is seen. */
+        __atomic_add_fetch(&h->senders_waiting, 1, __ATOMIC_SEQ_CST);
+        uint32_t seq = LOAD(&h->space_seq);
+        if (h->capacity - (head - LOAD(&h->tail)) >= rec) {
+            __atomic_sub_fetch(&h->senders_waiting, 1, __ATOMIC_SEQ_CST);
+            return 0;
+        }
+        err = ring_wait(&h->space_seq, seq, d);
+        __atomic_sub_fetch(&h->senders_waiting, 1, __ATOMIC_SEQ_CST);
+        if (err == ETIMEDOUT || err == EINTR) {
+            ring_unlock(&h->send_lock);
+            return err;
+        }
+    }
+}
+
+/* Acquire recv_lock and wait until a record is available.  Return 0 with
+   the lock held, or ETIMEDOUT or EINTR with the lock released. */
+static int
+ring_wait_data(ring_header *h, const ring_deadline *d)
+{
+    int err = ring_lock(&h->recv_lock, d);
+    if (err == EOWNERDEAD) {
+        /* The previous receiver may have died before waking senders */
+        __atomic_add_fetch(&h->space_seq, 1, __ATOMIC_SEQ_CST);
+        ring_wake(&h->space_seq);
+    }
+    else if (err) {
+        return err;
+    }
+    uint64_t tail = __atomic_load_n(&h->tail, __ATOMIC_RELAXED);
+    for (int i = 0; ; i++) {
+        if (LOAD(&h->head) != tail) {
+            return 0;
+        }
+        if (i < RING_SPIN_COUNT) {
+            continue;
+        }
+        __atomic_add_fetch(&h->receivers_waiting, 1, __ATOMIC_SEQ_CST);
+        uint32_t seq = LOAD(&h->data_seq);
+        if (LOAD(&h->head) != tail) {
+            __atomic_sub_fetch(&h->receivers_waiting, 1, __ATOMIC_SEQ_CST);
+            return 0;
+        }
+        err = ring_wait(&h->data_seq, seq, d);
+        __atomic_sub_fetch(&h->receivers_waiting, 1, __ATOMIC_SEQ_CST);
+        if (err == ETIMEDOUT || err == EINTR) {
+            ring_unlock(&h->recv_lock);
+            return err;
+        }
+    }
+}
+
+static void
+ring_write(ring_header *h, uint64_t pos, const void *src, uint64_t n)
+{
+    uint64_t offset = pos % h->capacity;
+    uint64_t first = Py_MIN(n, h->capacity - offset);
+    memcpy(RING_DATA(h) + offset, src, first);
+    memcpy(RING_DATA(h), (const char *)src + first, n - first);
+}
+
+static void
+ring_read(ring_header *h, uint64_t pos, void *dst, uint64_t n)
+{
+    uint64_t offset = pos % h->capacity;
+    uint64_t first = Py_MIN(n, h->capacity - offset);
+    memcpy(dst, RING_DATA(h) + offset, first);
+    memcpy((char *)dst + first, RING_DATA(h), n - first);
+}
+
+/* Wait for rec bytes of free space, or for a record if rec is 0, with the
+   GIL released.  Return 0 or ETIMEDOUT, or -1 with an exception set if a
+   signal handler raised. */
+static int
+ring_wait_and_check_signals(ring_header *h, uint64_t rec,
+                            const ring_deadline *d)
+{
+    int err;
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        err = rec ? ring_wait_space(h, rec, d) : ring_wait_data(h, d);
+        Py_END_ALLOW_THREADS
+    } while (err == EINTR && PyErr_CheckSignals() == 0);
+    if (err == EINTR) {
+        return -1;
+    }
+    return err;
+}
+
+static ring_header *
+ring_from_buffer(Py_buffer *buffer)
+{
+    ring_header *h = (ring_header *)buffer->buf;
+    if (buffer->len < RING_HEADER_SIZE + 8
+        || (uintptr_t)buffer->buf % 8 != 0
+        || h->magic != RING_MAGIC
+        || h->capacity % 8 != 0
+        || h->capacity > (uint64_t)(buffer->len - RING_HEADER_SIZE))
+    {
+        PyErr_SetString(PyExc_ValueError, "buffer does not hold a ring buffer");
+        return NULL;
+    }
+    return h;
+}
+
+/*[clinic input]
+_posixshmem.ring_init -> Py_ssize_t
+    buffer: Py_buffer(accept={rwbuffer})
+    /
+
+Initialize a ring buffer in a writable buffer.
+
+Returns the capacity of the ring buffer in bytes.
+[clinic start generated code]*/
+
+static Py_ssize_t
+_posixshmem_ring_init_impl(PyObject *module, Py_buffer *buffer)
+/*[clinic end generated code: output=c787752066d72bfa input=389a7fc8e03ba415]*/
+{
+    if (buffer->len < RING_HEADER_SIZE + 8 || (uintptr_t)buffer->buf % 8 != 0) {
+        PyErr_SetString(PyExc_ValueError, "buffer too small for a ring buffer");
+        return -1;
+    }
+    ring_header *h = (ring_header *)buffer->buf;
+    memset(h, 0, sizeof(ring_header));
+    h->capacity = (uint64_t)(buffer->len - RING_HEADER_SIZE) & ~(uint64_t)7;
+    STORE(&h->magic, RING_MAGIC);
+    return (Py_ssize_t)h->capacity;
+}
+
+/*[clinic input]
+_posixshmem.ring_capacity -> Py_ssize_t
+    buffer: Py_buffer(accept={rwbuffer})
+    /
+
+Return the capacity in bytes of the ring buffer held by a buffer.
+[clinic start generated code]*/
+
+static Py_ssize_t
+_posixshmem_ring_capacity_impl(PyObject *module, Py_buffer *buffer)
+/*[clinic end generated code: output=f9219a329cc3afc0 input=3bb9b46ae4023e62]*/
+{
+    ring_header *h = ring_from_buffer(buffer);
+    if (h == NULL) {
+        return -1;
+    }
+    return (Py_ssize_t)h->capacity;
+}
+
+/*[clinic input]
+_posixshmem.ring_put
+    buffer: Py_buffer(accept={rwbuffer})
+    parts: object
+    timeout: object = None
+    /
+
+Append a message to a ring buffer.
+
+The message is the concatenation of the bytes-like objects in the
+sequence *parts*.  Wait for enough free space in the ring buffer, for at
+most *timeout* seconds unless it is None.  Return False if the timeout
+expired, True otherwise.
+[clinic start generated code]*/
+
+static PyObject *
+_posixshmem_ring_put_impl(PyObject *module, Py_buffer *buffer,
+                          PyObject *parts, PyObject *timeout)
+/*[clinic end generated code: output=6f05247cafbe7b52 input=b37bbd3e4e9a887f]*/
+{
+    PyObject *result = NULL;
+    ring_deadline deadline;
+    ring_header *h = ring_from_buffer(buffer);
+    if (h == NULL || ring_deadline_init(&deadline, timeout) < 0) {
+        return NULL;
+    }
+    PyObject *seq = PySequence_Fast(parts, "parts must be a sequence");
+    if (seq == NULL) {
+        return NULL;
+    }
+    Py_ssize_t nparts = PySequence_Fast_GET_SIZE(seq);
+    Py_ssize_t nviews = 0;
+    Py_buffer *views = PyMem_New(Py_buffer, nparts);
+    if (views == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    uint64_t size = 0;
+    for (; nviews < nparts; nviews++) {
+        PyObject *part = PySequence_Fast_GET_ITEM(seq, nviews);
+        if (PyObject_GetBuffer(part, &views[nviews], PyBUF_SIMPLE) < 0) {
+            goto done;
+        }
+        size += (uint64_t)views[nviews].len;
+    }
+    uint64_t rec = RING_RECORD_SIZE(size);
+    if (rec > h->capacity) {
+        PyErr_SetString(PyExc_ValueError,
+                        "message too large for the ring buffer");
+        goto done;
+    }
+
+    int err = ring_wait_and_check_signals(h, rec, &deadline);
+    if (err < 0) {
+        goto done;
+    }
+    if (err == ETIMEDOUT) {
+        result = Py_NewRef(Py_False);
+        goto done;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    uint64_t head = __atomic_load_n(&h->head, __ATOMIC_RELAXED);
+    ring_write(h, head, &size, 8);
+    uint64_t pos = head + 8;
+    for (Py_ssize_t i = 0; i < nviews; i++) {
+        ring_write(h, pos, views[i].buf, (uint64_t)views[i].len);
+        pos += (uint64_t)views[i].len;
+    }
+    STORE(&h->head, head + rec);
+    __atomic_add_fetch(&h->data_seq, 1, __ATOMIC_SEQ_CST);
+    if (LOAD(&h->receivers_waiting)) {
+        ring_wake(&h->data_seq);
+    }
+    ring_unlock(&h->send_lock);
+    Py_END_ALLOW_THREADS
+    result = Py_NewRef(Py_True);
+
+done:
+    for (Py_ssize_t i = 0; i < nviews; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+    PyMem_Free(views);
+    Py_DECREF(seq);
+    return result;
+}
+
+/*[clinic input]
+_posixshmem.ring_get
+    buffer: Py_buffer(accept={rwbuffer})
+    timeout: object = None
+    /
+
+Remove the oldest message from a ring buffer and return it as bytes.
+
+Wait for a message, for at most *timeout* seconds unless it is None.
+Return None if the timeout expired.
+[clinic start generated code]*/
+
+static PyObject *
+_posixshmem_ring_get_impl(PyObject *module, Py_buffer *buffer,
+                          PyObject *timeout)
+/*[clinic end generated code: output=662075fbb647fd1f input=21d4731aaa67532e]*/
+{
+    ring_deadline deadline;
+    ring_header *h = ring_from_buffer(buffer);
+    if (h == NULL || ring_deadline_init(&deadline, timeout) < 0) {
+        return NULL;
+    }
+    int err = ring_wait_and_check_signals(h, 0, &deadline);
+    if (err < 0) {
+        return NULL;
+    }
+    if (err == ETIMEDOUT) {
+        Py_RETURN_NONE;
+    }
+
+    uint64_t tail = __atomic_load_n(&h->tail, __ATOMIC_RELAXED);
+    uint64_t size;
+    ring_read(h, tail, &size, 8);
+    uint64_t rec = RING_RECORD_SIZE(size);
+    if (size > h->capacity || rec > LOAD(&h->head) - tail) {
+        ring_unlock(&h->recv_lock);
+        PyErr_SetString(PyExc_RuntimeError, "corrupted ring buffer");
+        return NULL;
+    }
+    PyObject *result = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)size);
+    if (result == NULL) {
+        /* Leave the message for the next receiver */
+        ring_unlock(&h->recv_lock);
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    ring_read(h, tail + 8, PyBytes_AS_STRING(result), size);
+    STORE(&h->tail, tail + rec);
+    __atomic_add_fetch(&h->space_seq, 1, __ATOMIC_SEQ_CST);
+    if (LOAD(&h->senders_waiting)) {
+        ring_wake(&h->space_seq);
+    }
+    ring_unlock(&h->recv_lock);
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+/*[clinic input]
+_posixshmem.ring_poll
+    buffer: Py_buffer(accept={rwbuffer})
+    timeout: object = None
+    /
+
+Return whether a message is available in a ring buffer.
+
+Wait for a message, for at most *timeout* seconds unless it is None.
+[clinic start generated code]*/
+
+static PyObject *
+_posixshmem_ring_poll_impl(PyObject *module, Py_buffer *buffer,
+                           PyObject *timeout)
+/*[clinic end generated code: output=82148fb18f4d488e input=db059ba0f965c5f7]*/
+{
+    ring_deadline deadline;
+    ring_header *h = ring_from_buffer(buffer);
+    if (h == NULL || ring_deadline_init(&deadline, timeout) < 0) {
+        return NULL;
+    }
+    int err = ring_wait_and_check_signals(h, 0, &deadline);
+    if (err < 0) {
+        return NULL;
+    }
+    if (err == ETIMEDOUT) {
+        Py_RETURN_FALSE;
+    }
+    ring_unlock(&h->recv_lock);
+    Py_RETURN_TRUE;
+}
+
+#endif /* HAVE_SHM_RING */
+
 #include "clinic/posixshmem.c.h"
 
 static PyMethodDef module_methods[ ] = {
     _POSIXSHMEM_SHM_OPEN_METHODDEF
     _POSIXSHMEM_SHM_UNLINK_METHODDEF
+    _POSIXSHMEM_RING_INIT_METHODDEF
+    _POSIXSHMEM_RING_CAPACITY_METHODDEF
+    _POSIXSHMEM_RING_PUT_METHODDEF
+    _POSIXSHMEM_RING_GET_METHODDEF
+    _POSIXSHMEM_RING_POLL_METHODDEF
     {NULL} /* Sentinel */
 };
 
 
+static int
+posixshmem_exec(PyObject *module)
+{
+#ifdef HAVE_SHM_RING
+    if (PyModule_AddIntConstant(module, "RING_HEADER_SIZE",
+                                RING_HEADER_SIZE) < 0) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+static PyModuleDef_Slot module_slots[] = {
+    {Py_mod_exec, posixshmem_exec},
+    {0, NULL}
+};
+
 static struct PyModuleDef _posixshmemmodule = {
     PyModuleDef_HEAD_INIT,
     .m_name = "_posixshmem",
     .m_doc = "POSIX shared memory module",
     .m_size = 0,
     .m_methods = module_methods,
+    .m_slots = module_slots,
 };
 
 /* Module init function */
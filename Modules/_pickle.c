@@ -649,6 +649,8 @@ typedef struct PicklerObject {
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
     PyObject *buffer_callback;  /* Callback for out-of-band buffers, or NULL */
+    Py_ssize_t buffer_threshold; /* Size from which bytes-like objects are
+                                    offered to buffer_callback, or -1 */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -803,7 +805,11 @@ PyMemoTable_Del(PyMemoTable *self)
 }
 
 /* Since entries cannot be deleted from this hashtable, _PyMemoTable_Lookup()
-   can be considerably simpler than dictobject.c's lookdict(). */
+   can be considerably simpler than dictobject.c's lookdict().
+
+   The hash is the address of the object rotated by 4 bits, like
+   _Py_HashPointerRaw(): the low bits are always zero because of alignment,
+   and objects allocated one after the other get consecutive hashes. */
 static PyMemoEntry *
 _PyMemoTable_Lookup(PyMemoTable *self, PyObject *key)
 {
@@ -812,8 +818,9 @@ _PyMemoTable_Lookup(PyMemoTable *self, PyObject *key)
     size_t mask = self->mt_mask;
     PyMemoEntry *table = self->mt_table;
     PyMemoEntry *entry;
-    Py_hash_t hash = (Py_hash_t)key >> 3;
+    size_t hash = (size_t)key;
 
+    hash = (hash >> 4) | (hash << (8 * SIZEOF_VOID_P - 4));
     i = hash & mask;
     entry = &table[i];
     if (entry->me_key == NULL || entry->me_key == key)
@@ -927,6 +934,26 @@ PyMemoTable_Set(PyMemoTable *self, PyObject *key, Py_ssize_t value)
     return _PyMemoTable_ResizeTable(self, desired_size);
 }
 
+/* Number of entries PyMemoTable_Reserve() may be asked to make room for
+   in an empty memo */
+#define MEMO_RESERVE_MIN 4096
+
+/* Make room for n more entries without resizing.  This is only a hint:
+   n is ignored if it is too large.  Returns -1 if the table could not be
+   resized, 0 otherwise. */
+static int
+PyMemoTable_Reserve(PyMemoTable *self, size_t n)
+{
+    if (n > (SIZE_MAX / 3 - self->mt_used) / 2) {
+        return 0;
+    }
+    size_t used = self->mt_used + n;
+    if (used * 3 < self->mt_allocated * 2) {
+        return 0;
+    }
+    return _PyMemoTable_ResizeTable(self, used * 3 / 2 + 1);
+}
+
 #undef MT_MINSIZE
 #undef PERTURB_SHIFT
 
@@ -1110,6 +1137,7 @@ _Pickler_New(void)
     self->pers_func = NULL;
     self->dispatch_table = NULL;
     self->buffer_callback = NULL;
+    self->buffer_threshold = -1;
     self->write = NULL;
     self->proto = 0;
     self->bin = 0;
@@ -1182,8 +1210,11 @@ _Pickler_SetOutputStream(PicklerObject *self, PyObject *file)
 }
 
 static int
-_Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
+_Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback,
+                           PyObject *buffer_threshold)
 {
+    Py_ssize_t threshold = -1;
+
     if (buffer_callback == Py_None) {
         buffer_callback = NULL;
     }
@@ -1192,8 +1223,25 @@ _Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
                         "buffer_callback needs protocol >= 5");
         return -1;
     }
+    if (buffer_threshold != Py_None) {
+        if (buffer_callback == NULL) {
+            PyErr_SetString(PyExc_ValueError,
+                            "buffer_threshold needs a buffer_callback");
+            return -1;
+        }
+        threshold = PyNumber_AsSsize_t(buffer_threshold, PyExc_OverflowError);
+        if (threshold == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (threshold < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "buffer_threshold must be non-negative");
+            return -1;
+        }
+    }
 
     self->buffer_callback = Py_XNewRef(buffer_callback);
+    self->buffer_threshold = threshold;
     return 0;
 }
 
@@ -2551,6 +2599,93 @@ save_picklebuffer(PicklerObject *self, PyObject *obj)
     return 0;
 }
 
+/* Pickle a bytes, bytearray or memoryview object of at least
+   buffer_threshold bytes as if it was wrapped in a PickleBuffer, which lets
+   buffer_callback send it out-of-band.  Returns 1 if obj was pickled, 0 if
+   it should be pickled the usual way and -1 on error. */
+static int
+save_large_buffer(PicklerObject *self, PyObject *obj)
+{
+    Py_ssize_t size;
+    int status = -1;
+
+    assert(self->buffer_callback != NULL && self->buffer_threshold >= 0);
+    if (PyBytes_CheckExact(obj)) {
+        size = PyBytes_GET_SIZE(obj);
+    }
+    else if (PyByteArray_CheckExact(obj)) {
+        size = PyByteArray_GET_SIZE(obj);
+    }
+    else {
+        assert(PyMemoryView_Check(obj));
+        Py_buffer *mview = PyMemoryView_GET_BUFFER(obj);
+        if (mview->buf == NULL && PyMemoryView_GET_BASE(obj) != NULL) {
+            /* released memoryview; let the regular path report it */
+            return 0;
+        }
+        size = mview->len;
+    }
+    if (size < self->buffer_threshold) {
+        return 0;
+    }
+
+    PyObject *picklebuf = PyPickleBuffer_FromObject(obj);
+    if (picklebuf == NULL) {
+        return -1;
+    }
+    const Py_buffer *view = PyPickleBuffer_GetBuffer(picklebuf);
+    if (view == NULL) {
+        goto done;
+    }
+    if (view->suboffsets != NULL || !PyBuffer_IsContiguous(view, 'A')) {
+        status = 0;
+        goto done;
+    }
+    PyObject *ret = PyObject_CallOneArg(self->buffer_callback, picklebuf);
+    if (ret == NULL) {
+        goto done;
+    }
+    int in_band = PyObject_IsTrue(ret);
+    Py_DECREF(ret);
+    if (in_band == -1) {
+        goto done;
+    }
+    if (in_band) {
+        if (!PyMemoryView_Check(obj)) {
+            status = 0;
+        }
+        else if (view->readonly) {
+            status = _save_bytes_data(self, obj, (const char *)view->buf,
+                                      view->len) < 0 ? -1 : 1;
+        }
+        else {
+            status = _save_bytearray_data(self, obj, (const char *)view->buf,
+                                          view->len) < 0 ? -1 : 1;
+        }
+        goto done;
+    }
+
+    /* Write data out-of-band */
+    const char next_buffer_op = NEXT_BUFFER;
+    if (_Pickler_Write(self, &next_buffer_op, 1) < 0) {
+        goto done;
+    }
+    if (view->readonly) {
+        const char readonly_buffer_op = READONLY_BUFFER;
+        if (_Pickler_Write(self, &readonly_buffer_op, 1) < 0) {
+            goto done;
+        }
+    }
+    if (memo_put(self, obj) < 0) {
+        goto done;
+    }
+    status = 1;
+
+  done:
+    Py_DECREF(picklebuf);
+    return status;
+}
+
 /* A copy of PyUnicode_AsRawUnicodeEscapeString() that also translates
    backslash and newline characters to \uXXXX escapes. */
 static PyObject *
@@ -2959,6 +3094,113 @@ batch_list(PicklerObject *self, PyObject *iter)
     return -1;
 }
 
+/* Return whether obj is of a type that save() never memoizes. */
+static int
+is_unmemoized(PyObject *obj)
+{
+    return (obj == Py_None || PyBool_Check(obj) ||
+            PyLong_CheckExact(obj) || PyFloat_CheckExact(obj));
+}
+
+/* Pickle the longest run of items of the list obj, starting at index start
+ * and stopping before index end, that are None, booleans, floats or ints
+ * fitting in 4 bytes.  Returns the index of the first item which was not
+ * pickled, or -1 on error.
+ *
+ * Such items are not memoized and pickling them cannot run Python code, so
+ * rather than going through save() one opcode at a time, they are encoded
+ * into a local chunk which is written to the output buffer in one go.  The
+ * opcodes are the same that save() would emit, only the frame boundaries
+ * may move by less than a chunk.
+ *
+ * Note that this only works for protocols >= 2 and without persistent ids.
+ */
+static Py_ssize_t
+batch_list_atoms(PicklerObject *self, PyObject *obj,
+                 Py_ssize_t start, Py_ssize_t end)
+{
+    char chunk[512];
+    Py_ssize_t len = 0;
+    Py_ssize_t i;
+
+    assert(self->proto >= 2);
+    assert(self->pers_func == NULL);
+    assert(PyList_CheckExact(obj));
+
+    /* Writing to the output buffer can flush it to the file, which may run
+       arbitrary code, so the size of the list is checked at each step. */
+    for (i = start; i < end && i < PyList_GET_SIZE(obj); i++) {
+        PyObject *item = PyList_GET_ITEM(obj, i);
+        PyTypeObject *type = Py_TYPE(item);
+        char *p;
+
+        if (len > (Py_ssize_t)sizeof(chunk) - 9) {
+            if (_Pickler_Write(self, chunk, len) < 0 ||
+                _Pickler_OpcodeBoundary(self) < 0) {
+                return -1;
+            }
+            len = 0;
+            if (i >= PyList_GET_SIZE(obj)) {
+                break;
+            }
+            item = PyList_GET_ITEM(obj, i);
+            type = Py_TYPE(item);
+        }
+        p = chunk + len;
+
+        if (item == Py_None) {
+            p[0] = NONE;
+            len += 1;
+        }
+        else if (item == Py_True || item == Py_False) {
+            p[0] = (item == Py_True) ? NEWTRUE : NEWFALSE;
+            len += 1;
+        }
+        else if (type == &PyFloat_Type) {
+            p[0] = BINFLOAT;
+            if (PyFloat_Pack8(PyFloat_AS_DOUBLE(item), p + 1, 0) < 0) {
+                return -1;
+            }
+            len += 9;
+        }
+        else if (type == &PyLong_Type) {
+            int overflow;
+            long val = PyLong_AsLongAndOverflow(item, &overflow);
+            /* Same encoding as in save_long() */
+            if (overflow ||
+                val > 0x7fffffffL || val < (-0x7fffffffL - 1)) {
+                break;
+            }
+            p[1] = (unsigned char)(val & 0xff);
+            p[2] = (unsigned char)((val >> 8) & 0xff);
+            p[3] = (unsigned char)((val >> 16) & 0xff);
+            p[4] = (unsigned char)((val >> 24) & 0xff);
+            if ((p[4] != 0) || (p[3] != 0)) {
+                p[0] = BININT;
+                len += 5;
+            }
+            else if (p[2] != 0) {
+                p[0] = BININT2;
+                len += 3;
+            }
+            else {
+                p[0] = BININT1;
+                len += 2;
+            }
+        }
+        else {
+            break;
+        }
+    }
+    if (len > 0) {
+        if (_Pickler_Write(self, chunk, len) < 0 ||
+            _Pickler_OpcodeBoundary(self) < 0) {
+            return -1;
+        }
+    }
+    return i;
+}
+
 /* This is a variant of batch_list() above, specialized for lists (with no
  * support for list subclasses). Like batch_list(), we batch up chunks of
  *     MARK item item ... item APPENDS
@@ -2975,6 +3217,7 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
 {
     PyObject *item = NULL;
     Py_ssize_t this_batch, total;
+    int atoms = (self->proto >= 2 && self->pers_func == NULL);
 
     const char append_op = APPEND;
     const char appends_op = APPENDS;
@@ -2996,6 +3239,20 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
         return 0;
     }
 
+    /* If the items are distinct objects which are not atoms, most of them
+       will be memoized: make room for them at once rather than growing the
+       memo step by step.  The first two items are the only ones looked at,
+       so the reservation is capped to at most double the memo. */
+    item = PyList_GET_ITEM(obj, 0);
+    if (!self->fast && item != PyList_GET_ITEM(obj, 1) &&
+        !is_unmemoized(item) && !is_unmemoized(PyList_GET_ITEM(obj, 1)))
+    {
+        size_t n = Py_MIN((size_t)PyList_GET_SIZE(obj),
+                          Py_MAX(self->memo->mt_used, MEMO_RESERVE_MIN));
+        if (PyMemoTable_Reserve(self->memo, n) < 0)
+            return -1;
+    }
+
     /* Write in batches of BATCHSIZE. */
     total = 0;
     do {
@@ -3003,6 +3260,16 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, &mark_op, 1) < 0)
             return -1;
         while (total < PyList_GET_SIZE(obj)) {
+            if (atoms) {
+                Py_ssize_t next = batch_list_atoms(self, obj, total,
+                                                   total + BATCHSIZE - this_batch);
+                if (next < 0)
+                    return -1;
+                this_batch += next - total;
+                total = next;
+                if (this_batch == BATCHSIZE || total >= PyList_GET_SIZE(obj))
+                    break;
+            }
             item = PyList_GET_ITEM(obj, total);
             Py_INCREF(item);
             int err = save(self, item, 0);
@@ -4290,6 +4557,16 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
         return memo_get(self, obj);
     }
 
+    if (self->buffer_threshold >= 0 &&
+        (type == &PyBytes_Type || type == &PyByteArray_Type ||
+         type == &PyMemoryView_Type))
+    {
+        status = save_large_buffer(self, obj);
+        if (status != 0) {
+            return status < 0 ? -1 : 0;
+        }
+    }
+
     if (type == &PyBytes_Type) {
         return save_bytes(self, obj);
     }
@@ -4664,6 +4941,7 @@ _pickle.Pickler.__init__
   protocol: object = None
   fix_imports: bool = True
   buffer_callback: object = None
+  buffer_threshold: object = None
 
 This takes a binary file for writing a pickle data stream.
 
@@ -4696,13 +4974,19 @@ buffer is serialized in-band, i.e. inside the pickle stream.
 It is an error if *buffer_callback* is not None and *protocol*
 is None or smaller than 5.
 
+If *buffer_threshold* is not None, bytes, bytearray and contiguous
+memoryview objects of at least that many bytes are passed to
+*buffer_callback* as if they were wrapped in a PickleBuffer, so they
+can be sent out-of-band too.  It requires a *buffer_callback*.
+
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
                               PyObject *protocol, int fix_imports,
-                              PyObject *buffer_callback)
-/*[clinic end generated code: output=0abedc50590d259b input=a7c969699bf5dad3]*/
+                              PyObject *buffer_callback,
+                              PyObject *buffer_threshold)
+/*[clinic end generated code: output=bebf391b6c305f92 input=ac94e0bc2e97c9a6]*/
 {
     /* In case of multiple __init__() calls, clear previous content. */
     if (self->write != NULL)
@@ -4714,7 +4998,8 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
     if (_Pickler_SetOutputStream(self, file) < 0)
         return -1;
 
-    if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
+    if (_Pickler_SetBufferCallback(self, buffer_callback,
+                                   buffer_threshold) < 0)
         return -1;
 
     /* memo and output_buffer may have already been created in _Pickler_New */
@@ -7601,6 +7886,7 @@ _pickle.dump
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  buffer_threshold: object = None
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7629,13 +7915,16 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *buffer_threshold* is not None, large enough bytes, bytearray and
+memoryview objects are also passed to *buffer_callback*.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
                   PyObject *protocol, int fix_imports,
-                  PyObject *buffer_callback)
-/*[clinic end generated code: output=706186dba996490c input=5ed6653da99cd97c]*/
+                  PyObject *buffer_callback, PyObject *buffer_threshold)
+/*[clinic end generated code: output=315019822a384a38 input=d624569af4413ac3]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -7648,7 +7937,8 @@ _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
     if (_Pickler_SetOutputStream(pickler, file) < 0)
         goto error;
 
-    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback,
+                                   buffer_threshold) < 0)
         goto error;
 
     if (dump(pickler, obj) < 0)
@@ -7674,6 +7964,7 @@ _pickle.dumps
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  buffer_threshold: object = None
 
 Return the pickled representation of the object as a bytes object.
 
@@ -7694,12 +7985,16 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *buffer_threshold* is not None, large enough bytes, bytearray and
+memoryview objects are also passed to *buffer_callback*.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports, PyObject *buffer_callback)
-/*[clinic end generated code: output=fbab0093a5580fdf input=e543272436c6f987]*/
+                   int fix_imports, PyObject *buffer_callback,
+                   PyObject *buffer_threshold)
+/*[clinic end generated code: output=b28415dd26e1825f input=c8369c3ad2a0ddb9]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7710,7 +8005,8 @@ _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
     if (_Pickler_SetProtocol(pickler, protocol, fix_imports) < 0)
         goto error;
 
-    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback,
+                                   buffer_threshold) < 0)
         goto error;
 
     if (dump(pickler, obj) < 0)
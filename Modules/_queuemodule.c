@@ -23,12 +23,172 @@ static struct PyModuleDef queuemodule;
 #define simplequeue_get_state_by_type(type) \
     (simplequeue_get_state(PyType_GetModuleByDef(type, &queuemodule)))
 
+/* A circular buffer of object references.  Unlike a list used as a
+   FIFO, it never moves the queued items when one is removed from the
+   front: only the buffer resizes copy them. */
+typedef struct {
+    /* Allocated items, a power of 2 */
+    Py_ssize_t items_cap;
+    /* Index of the oldest item */
+    Py_ssize_t get_idx;
+    Py_ssize_t num_items;
+    PyObject **items;
+} RingBuf;
+
+#define RINGBUF_MIN_CAP 8
+
+static int
+RingBuf_Init(RingBuf *buf)
+{
+    buf->items_cap = RINGBUF_MIN_CAP;
+    buf->get_idx = 0;
+    buf->num_items = 0;
+    buf->items = PyMem_New(PyObject *, buf->items_cap);
+    if (buf->items == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+RingBuf_At(RingBuf *buf, Py_ssize_t idx)
+{
+    assert(idx >= 0 && idx < buf->num_items);
+    return buf->items[(buf->get_idx + idx) & (buf->items_cap - 1)];
+}
+
+static void
+RingBuf_Fini(RingBuf *buf)
+{
+    PyObject **items = buf->items;
+    Py_ssize_t cap = buf->items_cap;
+    Py_ssize_t idx = buf->get_idx;
+    Py_ssize_t num_items = buf->num_items;
+
+    /* Detach the items first: a destructor may access the queue */
+    buf->items = NULL;
+    buf->items_cap = 0;
+    buf->get_idx = 0;
+    buf->num_items = 0;
+    for (; num_items > 0; num_items--) {
+        Py_DECREF(items[idx]);
+        idx = (idx + 1) & (cap - 1);
+    }
+    PyMem_Free(items);
+}
+
+/* Copy the items to a new buffer of new_cap items, with the oldest item
+   at index 0.  Return -1 with an exception set on memory error. */
+static int
+resize_ringbuf(RingBuf *buf, Py_ssize_t new_cap)
+{
+    assert(new_cap >= buf->num_items);
+    assert((new_cap & (new_cap - 1)) == 0);
+    PyObject **new_items = PyMem_New(PyObject *, new_cap);
+    if (new_items == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    if (buf->num_items > 0) {
+        /* The items can wrap around the end of the old buffer: copy the
+           two chunks */
+        Py_ssize_t first = Py_MIN(buf->num_items,
+                                  buf->items_cap - buf->get_idx);
+        memcpy(new_items, buf->items + buf->get_idx,
+               first * sizeof(PyObject *));
+        memcpy(new_items + first, buf->items,
+               (buf->num_items - first) * sizeof(PyObject *));
+    }
+
+    PyMem_Free(buf->items);
+    buf->items = new_items;
+    buf->items_cap = new_cap;
+    buf->get_idx = 0;
+    return 0;
+}
+
+/* Make room for n more items */
+static int
+RingBuf_Reserve(RingBuf *buf, Py_ssize_t n)
+{
+    if (n <= buf->items_cap - buf->num_items) {
+        return 0;
+    }
+    Py_ssize_t new_cap = Py_MAX(buf->items_cap, RINGBUF_MIN_CAP);
+    while (new_cap - buf->num_items < n) {
+        if (new_cap > PY_SSIZE_T_MAX / 2 / (Py_ssize_t)sizeof(PyObject *)) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        new_cap *= 2;
+    }
+    return resize_ringbuf(buf, new_cap);
+}
+
+/* Append an item, stealing a reference to it.  There must be room for it:
+   see RingBuf_Reserve(). */
+static void
+RingBuf_PutReserved(RingBuf *buf, PyObject *item)
+{
+    assert(buf->num_items < buf->items_cap);
+    Py_ssize_t put_idx = (buf->get_idx + buf->num_items) & (buf->items_cap - 1);
+    buf->items[put_idx] = item;
+    buf->num_items++;
+}
+
+/* Append a new reference to item.  Return -1 with an exception set on
+   memory error. */
+static int
+RingBuf_Put(RingBuf *buf, PyObject *item)
+{
+    if (RingBuf_Reserve(buf, 1) < 0) {
+        return -1;
+    }
+    RingBuf_PutReserved(buf, Py_NewRef(item));
+    return 0;
+}
+
+/* Remove the oldest item and return the reference to it. */
+static PyObject *
+RingBuf_Get(RingBuf *buf)
+{
+    assert(buf->num_items > 0);
+    PyObject *item = buf->items[buf->get_idx];
+    buf->items[buf->get_idx] = NULL;
+    buf->get_idx = (buf->get_idx + 1) & (buf->items_cap - 1);
+    buf->num_items--;
+
+    /* Release memory once the buffer is less than 25% full.  This can't
+       fail in a way which loses the item: keep the big buffer instead. */
+    if (buf->num_items < buf->items_cap / 4
+        && buf->items_cap > RINGBUF_MIN_CAP)
+    {
+        if (resize_ringbuf(buf, buf->items_cap / 2) < 0) {
+            PyErr_Clear();
+        }
+    }
+    return item;
+}
+
+static Py_ssize_t
+RingBuf_Len(RingBuf *buf)
+{
+    return buf->num_items;
+}
+
+static int
+RingBuf_IsEmpty(RingBuf *buf)
+{
+    return buf->num_items == 0;
+}
+
 typedef struct {
     PyObject_HEAD
     PyThread_type_lock lock;
     int locked;
-    PyObject *lst;
-    Py_ssize_t lst_pos;
+    RingBuf buf;
     PyObject *weakreflist;
 } simplequeueobject;
 
@@ -41,7 +201,7 @@ class _queue.SimpleQueue "simplequeueobject *" "simplequeue_get_state_by_type(ty
 static int
 simplequeue_clear(simplequeueobject *self)
 {
-    Py_CLEAR(self->lst);
+    RingBuf_Fini(&self->buf);
     return 0;
 }
 
@@ -67,7 +227,10 @@ simplequeue_dealloc(simplequeueobject *self)
 static int
 simplequeue_traverse(simplequeueobject *self, visitproc visit, void *arg)
 {
-    Py_VISIT(self->lst);
+    RingBuf *buf = &self->buf;
+    for (Py_ssize_t i = 0, num_items = buf->num_items; i < num_items; i++) {
+        Py_VISIT(RingBuf_At(buf, i));
+    }
     Py_VISIT(Py_TYPE(self));
     return 0;
 }
@@ -88,15 +251,13 @@ simplequeue_new_impl(PyTypeObject *type)
     self = (simplequeueobject *) type->tp_alloc(type, 0);
     if (self != NULL) {
         self->weakreflist = NULL;
-        self->lst = PyList_New(0);
         self->lock = PyThread_allocate_lock();
-        self->lst_pos = 0;
         if (self->lock == NULL) {
             Py_DECREF(self);
             PyErr_SetString(PyExc_MemoryError, "can't allocate lock");
             return NULL;
         }
-        if (self->lst == NULL) {
+        if (RingBuf_Init(&self->buf) < 0) {
             Py_DECREF(self);
             return NULL;
         }
@@ -124,7 +285,7 @@ _queue_SimpleQueue_put_impl(simplequeueobject *self, PyObject *item,
 /*[clinic end generated code: output=4333136e88f90d8b input=6e601fa707a782d5]*/
 {
     /* BEGIN GIL-protected critical section */
-    if (PyList_Append(self->lst, item) < 0)
+    if (RingBuf_Put(&self->buf, item) < 0)
         return NULL;
     if (self->locked) {
         /* A get() may be waiting, wake it up */
@@ -136,78 +297,74 @@ _queue_SimpleQueue_put_impl(simplequeueobject *self, PyObject *item,
 }
 
 /*[clinic input]
-_queue.SimpleQueue.put_nowait
-    item: object
+_queue.SimpleQueue.put_many
+    items: object
+    /
 
-Put an item into the queue without blocking.
+Put all the items of an iterable on the queue.
 
-This is exactly equivalent to `put(item)` and is only provided
-for compatibility with the Queue class.
+Waiting consumers are woken up once rather than once per item.
+This method never blocks.
 
 [clinic start generated code]*/
 
 static PyObject *
-_queue_SimpleQueue_put_nowait_impl(simplequeueobject *self, PyObject *item)
-/*[clinic end generated code: output=0990536715efb1f1 input=36b1ea96756b2ece]*/
+_queue_SimpleQueue_put_many(simplequeueobject *self, PyObject *items)
+/*[clinic end generated code: output=5f53df0b226d2025 input=f14848f72d1cc800]*/
 {
-    return _queue_SimpleQueue_put_impl(self, item, 0, Py_None);
-}
-
-static PyObject *
-simplequeue_pop_item(simplequeueobject *self)
-{
-    Py_ssize_t count, n;
-    PyObject *item;
+    PyObject *seq = PySequence_Fast(items, "put_many() argument must be "
+                                           "an iterable");
+    if (seq == NULL) {
+        return NULL;
+    }
 
-    n = PyList_GET_SIZE(self->lst);
-    assert(self->lst_pos < n);
-
-    item = PyList_GET_ITEM(self->lst, self->lst_pos);
-    Py_INCREF(Py_None);
-    PyList_SET_ITEM(self->lst, self->lst_pos, Py_None);
-    self->lst_pos += 1;
-    count = n - self->lst_pos;
-    if (self->lst_pos > count) {
-        /* The list is more than 50% empty, reclaim space at the beginning */
-        if (PyList_SetSlice(self->lst, 0, self->lst_pos, NULL)) {
-            /* Undo pop */
-            self->lst_pos -= 1;
-            PyList_SET_ITEM(self->lst, self->lst_pos, item);
-            return NULL;
-        }
-        self->lst_pos = 0;
+    /* BEGIN GIL-protected critical section */
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    if (RingBuf_Reserve(&self->buf, n) < 0) {
+        Py_DECREF(seq);
+        return NULL;
     }
-    return item;
+    PyObject **src = PySequence_Fast_ITEMS(seq);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        RingBuf_PutReserved(&self->buf, Py_NewRef(src[i]));
+    }
+    if (n > 0 && self->locked) {
+        /* A get() may be waiting, wake it up */
+        self->locked = 0;
+        PyThread_release_lock(self->lock);
+    }
+    /* END GIL-protected critical section */
+
+    Py_DECREF(seq);
+    Py_RETURN_NONE;
 }
 
 /*[clinic input]
-_queue.SimpleQueue.get
-
-    cls: defining_class
-    /
-    block: bool = True
-    timeout as timeout_obj: object = None
+_queue.SimpleQueue.put_nowait
+    item: object
 
-Remove and return an item from the queue.
+Put an item into the queue without blocking.
 
-If optional args 'block' is true and 'timeout' is None (the default),
-block if necessary until an item is available. If 'timeout' is
-a non-negative number, it blocks at most 'timeout' seconds and raises
-the Empty exception if no item was available within that time.
-Otherwise ('block' is false), return an item if one is immediately
-available, else raise the Empty exception ('timeout' is ignored
-in that case).
+This is exactly equivalent to `put(item)` and is only provided
+for compatibility with the Queue class.
 
 [clinic start generated code]*/
 
 static PyObject *
-_queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
-                            int block, PyObject *timeout_obj)
-/*[clinic end generated code: output=5c2cca914cd1e55b input=5b4047bfbc645ec1]*/
+_queue_SimpleQueue_put_nowait_impl(simplequeueobject *self, PyObject *item)
+/*[clinic end generated code: output=0990536715efb1f1 input=36b1ea96756b2ece]*/
+{
+    return _queue_SimpleQueue_put_impl(self, item, 0, Py_None);
+}
+
+/* Wait until the queue is non-empty.  Return 0 on success, or -1 with
+   an exception set on timeout or if a signal handler raised one. */
+static int
+simplequeue_wait(simplequeueobject *self, PyTypeObject *cls,
+                 int block, PyObject *timeout_obj)
 {
     _PyTime_t endtime = 0;
     _PyTime_t timeout;
-    PyObject *item;
     PyLockStatus r;
     PY_TIMEOUT_T microseconds;
 
@@ -219,19 +376,19 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
         /* With timeout */
         if (_PyTime_FromSecondsObject(&timeout,
                                       timeout_obj, _PyTime_ROUND_CEILING) < 0) {
-            return NULL;
+            return -1;
         }
         if (timeout < 0) {
             PyErr_SetString(PyExc_ValueError,
                             "'timeout' must be a non-negative number");
-            return NULL;
+            return -1;
         }
         microseconds = _PyTime_AsMicroseconds(timeout,
                                               _PyTime_ROUND_CEILING);
         if (microseconds > PY_TIMEOUT_MAX) {
             PyErr_SetString(PyExc_OverflowError,
                             "timeout value is too large");
-            return NULL;
+            return -1;
         }
         endtime = _PyDeadline_Init(timeout);
     }
@@ -244,7 +401,7 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
      * So we simply try to acquire the lock in a loop, until the condition
      * (queue non-empty) becomes true.
      */
-    while (self->lst_pos == PyList_GET_SIZE(self->lst)) {
+    while (RingBuf_IsEmpty(&self->buf)) {
         /* First a simple non-blocking try without releasing the GIL */
         r = PyThread_acquire_lock_timed(self->lock, 0, 0);
         if (r == PY_LOCK_FAILURE && microseconds != 0) {
@@ -254,14 +411,14 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
         }
 
         if (r == PY_LOCK_INTR && Py_MakePendingCalls() < 0) {
-            return NULL;
+            return -1;
         }
         if (r == PY_LOCK_FAILURE) {
             PyObject *module = PyType_GetModule(cls);
             simplequeue_state *state = simplequeue_get_state(module);
             /* Timed out */
             PyErr_SetNone(state->EmptyError);
-            return NULL;
+            return -1;
         }
         self->locked = 1;
 
@@ -272,10 +429,43 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
                                                   _PyTime_ROUND_CEILING);
         }
     }
+    return 0;
+}
+
+/*[clinic input]
+_queue.SimpleQueue.get
+
+    cls: defining_class
+    /
+    block: bool = True
+    timeout as timeout_obj: object = None
+
+Remove and return an item from the queue.
+
+If optional args 'block' is true and 'timeout' is None (the default),
+block if necessary until an item is available. If 'timeout' is
+a non-negative number, it blocks at most 'timeout' seconds and raises
+the Empty exception if no item was available within that time.
+Otherwise ('block' is false), return an item if one is immediately
+available, else raise the Empty exception ('timeout' is ignored
+in that case).
+
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
+                            int block, PyObject *timeout_obj)
+/*[clinic end generated code: output=5c2cca914cd1e55b input=5b4047bfbc645ec1]*/
+{
+    PyObject *item;
+
+    if (simplequeue_wait(self, cls, block, timeout_obj) < 0) {
+        return NULL;
+    }
 
     /* BEGIN GIL-protected critical section */
-    assert(self->lst_pos < PyList_GET_SIZE(self->lst));
-    item = simplequeue_pop_item(self);
+    assert(!RingBuf_IsEmpty(&self->buf));
+    item = RingBuf_Get(&self->buf);
     if (self->locked) {
         PyThread_release_lock(self->lock);
         self->locked = 0;
@@ -285,6 +475,65 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
     return item;
 }
 
+/*[clinic input]
+_queue.SimpleQueue.get_many
+
+    cls: defining_class
+    /
+    max_items: Py_ssize_t(accept={int, NoneType}, c_default="-1") = None
+    block: bool = True
+    timeout as timeout_obj: object = None
+
+Remove and return a list of items from the queue.
+
+Wait for an item like get(), then return it together with the other
+items immediately available, oldest first.  At most 'max_items' items
+are returned; all the available items if it is None or negative.
+
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_get_many_impl(simplequeueobject *self, PyTypeObject *cls,
+                                 Py_ssize_t max_items, int block,
+                                 PyObject *timeout_obj)
+/*[clinic end generated code: output=5db4d0fe54081e21 input=0a4754edd135f4ff]*/
+{
+    if (max_items == 0) {
+        return PyList_New(0);
+    }
+    if (simplequeue_wait(self, cls, block, timeout_obj) < 0) {
+        return NULL;
+    }
+
+    /* Creating the list can trigger a garbage collection, and finalizers
+       using the queue: only count the items afterwards. */
+    PyObject *result = PyList_New(0);
+
+    /* BEGIN GIL-protected critical section */
+    if (result != NULL) {
+        Py_ssize_t n = RingBuf_Len(&self->buf);
+        if (max_items > 0 && max_items < n) {
+            n = max_items;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            /* Only remove the item once it is in the list, so that it
+               stays in the queue on memory error */
+            if (PyList_Append(result, RingBuf_At(&self->buf, 0)) < 0) {
+                Py_CLEAR(result);
+                break;
+            }
+            Py_DECREF(RingBuf_Get(&self->buf));
+        }
+    }
+    if (self->locked) {
+        PyThread_release_lock(self->lock);
+        self->locked = 0;
+    }
+    /* END GIL-protected critical section */
+
+    return result;
+}
+
 /*[clinic input]
 _queue.SimpleQueue.get_nowait
 
@@ -315,7 +564,7 @@ static int
 _queue_SimpleQueue_empty_impl(simplequeueobject *self)
 /*[clinic end generated code: output=1a02a1b87c0ef838 input=1a98431c45fd66f9]*/
 {
-    return self->lst_pos == PyList_GET_SIZE(self->lst);
+    return RingBuf_IsEmpty(&self->buf);
 }
 
 /*[clinic input]
@@ -328,7 +577,7 @@ static Py_ssize_t
 _queue_SimpleQueue_qsize_impl(simplequeueobject *self)
 /*[clinic end generated code: output=f9dcd9d0a90e121e input=7a74852b407868a1]*/
 {
-    return PyList_GET_SIZE(self->lst) - self->lst_pos;
+    return RingBuf_Len(&self->buf);
 }
 
 static int
@@ -361,8 +610,10 @@ queue_free(void *m)
 static PyMethodDef simplequeue_methods[] = {
     _QUEUE_SIMPLEQUEUE_EMPTY_METHODDEF
     _QUEUE_SIMPLEQUEUE_GET_METHODDEF
+    _QUEUE_SIMPLEQUEUE_GET_MANY_METHODDEF
     _QUEUE_SIMPLEQUEUE_GET_NOWAIT_METHODDEF
     _QUEUE_SIMPLEQUEUE_PUT_METHODDEF
+    _QUEUE_SIMPLEQUEUE_PUT_MANY_METHODDEF
     _QUEUE_SIMPLEQUEUE_PUT_NOWAIT_METHODDEF
     _QUEUE_SIMPLEQUEUE_QSIZE_METHODDEF
     {"__class_getitem__",    Py_GenericAlias,
@@ -3960,6 +3960,93 @@ sock_recvmsg_impl(PySocketSockObject *s, void *data)
     return  (ctx->result >= 0);
 }
 
+/*
+ * Return a list of (level, type, data) tuples made from the control
+ * messages in msg, or NULL with an exception set.
+ */
+static PyObject *
+make_cmsg_list(struct msghdr *msg)
+{
+    PyObject *cmsg_list;
+    struct cmsghdr *cmsgh;
+    size_t cmsgdatalen = 0;
+    int cmsg_status;
+
+    if ((cmsg_list = PyList_New(0)) == NULL)
+        return NULL;
+    /* Check for empty ancillary data as old CMSG_FIRSTHDR()
+       implementations didn't do so. */
+    for (cmsgh = ((msg->msg_controllen > 0) ? CMSG_FIRSTHDR(msg) : NULL);
+         cmsgh != NULL; cmsgh = CMSG_NXTHDR(msg, cmsgh)) {
+        PyObject *bytes, *tuple;
+        int tmp;
+
+        cmsg_status = get_cmsg_data_len(msg, cmsgh, &cmsgdatalen);
+        if (cmsg_status != 0) {
+            if (PyErr_WarnEx(PyExc_RuntimeWarning,
+                             "received malformed or improperly-truncated "
+                             "ancillary data", 1) == -1)
+                goto error;
+        }
+        if (cmsg_status < 0)
+            break;
+        if (cmsgdatalen > PY_SSIZE_T_MAX) {
+            PyErr_SetString(PyExc_OSError, "control message too long");
+            goto error;
+        }
+
+        bytes = PyBytes_FromStringAndSize((char *)CMSG_DATA(cmsgh),
+                                          cmsgdatalen);
+        tuple = Py_BuildValue("iiN", (int)cmsgh->cmsg_level,
+                              (int)cmsgh->cmsg_type, bytes);
+        if (tuple == NULL)
+            goto error;
+        tmp = PyList_Append(cmsg_list, tuple);
+        Py_DECREF(tuple);
+        if (tmp != 0)
+            goto error;
+
+        if (cmsg_status != 0)
+            break;
+    }
+    return cmsg_list;
+
+error:
+    Py_DECREF(cmsg_list);
+    return NULL;
+}
+
+/* Close all descriptors received in msg via SCM_RIGHTS, so they don't
+   leak when the ancillary data can't be returned. */
+static void
+close_cmsg_fds(struct msghdr *msg)
+{
+#ifdef SCM_RIGHTS
+    struct cmsghdr *cmsgh;
+    size_t cmsgdatalen = 0;
+    int cmsg_status;
+
+    for (cmsgh = ((msg->msg_controllen > 0) ? CMSG_FIRSTHDR(msg) : NULL);
+         cmsgh != NULL; cmsgh = CMSG_NXTHDR(msg, cmsgh)) {
+        cmsg_status = get_cmsg_data_len(msg, cmsgh, &cmsgdatalen);
+        if (cmsg_status < 0)
+            break;
+        if (cmsgh->cmsg_level == SOL_SOCKET &&
+            cmsgh->cmsg_type == SCM_RIGHTS) {
+            size_t numfds;
+            int *fdp;
+
+            numfds = cmsgdatalen / sizeof(int);
+            fdp = (int *)CMSG_DATA(cmsgh);
+            while (numfds-- > 0)
+                close(*fdp++);
+        }
+        if (cmsg_status != 0)
+            break;
+    }
+#endif /* SCM_RIGHTS */
+}
+
 /*
  * Call recvmsg() with the supplied iovec structures, flags, and
  * ancillary data buffer size (controllen).  Returns the tuple return
@@ -3980,9 +4067,6 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
     struct msghdr msg = {0};
     PyObject *cmsg_list = NULL, *retval = NULL;
     void *controlbuf = NULL;
-    struct cmsghdr *cmsgh;
-    size_t cmsgdatalen = 0;
-    int cmsg_status;
     struct sock_recvmsg ctx;
 
     /* XXX: POSIX says that msg_name and msg_namelen "shall be
@@ -4023,43 +4107,8 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
         goto finally;
 
     /* Make list of (level, type, data) tuples from control messages. */
-    if ((cmsg_list = PyList_New(0)) == NULL)
+    if ((cmsg_list = make_cmsg_list(&msg)) == NULL)
         goto err_closefds;
-    /* Check for empty ancillary data as old CMSG_FIRSTHDR()
-       implementations didn't do so. */
-    for (cmsgh = ((msg.msg_controllen > 0) ? CMSG_FIRSTHDR(&msg) : NULL);
-         cmsgh != NULL; cmsgh = CMSG_NXTHDR(&msg, cmsgh)) {
-        PyObject *bytes, *tuple;
-        int tmp;
-
-        cmsg_status = get_cmsg_data_len(&msg, cmsgh, &cmsgdatalen);
-        if (cmsg_status != 0) {
-            if (PyErr_WarnEx(PyExc_RuntimeWarning,
-                             "received malformed or improperly-truncated "
-                             "ancillary data", 1) == -1)
-                goto err_closefds;
-        }
-        if (cmsg_status < 0)
-            break;
-        if (cmsgdatalen > PY_SSIZE_T_MAX) {
-            PyErr_SetString(PyExc_OSError, "control message too long");
-            goto err_closefds;
-        }
-
-        bytes = PyBytes_FromStringAndSize((char *)CMSG_DATA(cmsgh),
-                                          cmsgdatalen);
-        tuple = Py_BuildValue("iiN", (int)cmsgh->cmsg_level,
-                              (int)cmsgh->cmsg_type, bytes);
-        if (tuple == NULL)
-            goto err_closefds;
-        tmp = PyList_Append(cmsg_list, tuple);
-        Py_DECREF(tuple);
-        if (tmp != 0)
-            goto err_closefds;
-
-        if (cmsg_status != 0)
-            break;
-    }
 
     retval = Py_BuildValue("NOiN",
                            (*makeval)(ctx.result, makeval_data),
@@ -4078,27 +4127,7 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
     return retval;
 
 err_closefds:
-#ifdef SCM_RIGHTS
-    /* Close all descriptors coming from SCM_RIGHTS, so they don't leak. */
-    for (cmsgh = ((msg.msg_controllen > 0) ? CMSG_FIRSTHDR(&msg) : NULL);
-         cmsgh != NULL; cmsgh = CMSG_NXTHDR(&msg, cmsgh)) {
-        cmsg_status = get_cmsg_data_len(&msg, cmsgh, &cmsgdatalen);
-        if (cmsg_status < 0)
-            break;
-        if (cmsgh->cmsg_level == SOL_SOCKET &&
-            cmsgh->cmsg_type == SCM_RIGHTS) {
-            size_t numfds;
-            int *fdp;
-
-            numfds = cmsgdatalen / sizeof(int);
-            fdp = (int *)CMSG_DATA(cmsgh);
-            while (numfds-- > 0)
-                close(*fdp++);
-        }
-        if (cmsg_status != 0)
-            break;
-    }
-#endif /* SCM_RIGHTS */
+    close_cmsg_fds(&msg);
     goto finally;
 }
 
@@ -4947,6 +4976,310 @@ Set operation mode, IV and length of associated data for an AF_ALG\n\
 operation socket.");
 #endif
 
+#if defined(HAVE_RECVMMSG) && defined(CMSG_LEN)
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags,
+                           NULL);
+    return (ctx->result >= 0);
+}
+
+/* s.recvmmsg_into(buffers[, ancbufsize[, flags]]) method */
+
+static PyObject *
+sock_recvmmsg_into(PySocketSockObject *s, PyObject *args)
+{
+    Py_ssize_t ancbufsize = 0, controlstride;
+    int flags = 0;
+    socklen_t addrbuflen;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    char *controlbufs = NULL;
+    Py_buffer *bufs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    PyObject *buffers_arg, *fast, *retval = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|ni:recvmmsg_into",
+                          &buffers_arg, &ancbufsize, &flags))
+        return NULL;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        return NULL;
+    if (ancbufsize < 0 || ancbufsize > SOCKLEN_T_LIMIT) {
+        PyErr_SetString(PyExc_ValueError,
+                        "invalid ancillary data buffer length");
+        return NULL;
+    }
+    /* Each message gets its own ancillary data buffer, aligned so that
+       CMSG_FIRSTHDR() points to a properly aligned header. */
+    controlstride = _Py_SIZE_ROUND_UP(ancbufsize, _Alignof(struct cmsghdr));
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+
+    if (controlstride > 0 && nitems > PY_SSIZE_T_MAX / controlstride) {
+        PyErr_SetString(PyExc_ValueError,
+                        "invalid ancillary data buffer length");
+        goto finally;
+    }
+
+    /* Fill in a message header with a single iovec, an address buffer and
+       an ancillary data buffer for each item, and save the Py_buffer
+       structs to release afterwards. */
+    msgvec = PyMem_Calloc(nitems, sizeof(struct mmsghdr));
+    iovs = PyMem_New(struct iovec, nitems);
+    addrbufs = PyMem_New(sock_addr_t, nitems);
+    bufs = PyMem_New(Py_buffer, nitems);
+    if (controlstride > 0)
+        controlbufs = PyMem_Malloc(nitems * controlstride);
+    if (msgvec == NULL || iovs == NULL || addrbufs == NULL || bufs == NULL ||
+        (controlstride > 0 && controlbufs == NULL)) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    for (; nbufs < nitems; nbufs++) {
+        struct msghdr *msg = &msgvec[nbufs].msg_hdr;
+
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        /* See the comment in sock_recvmsg_guts() */
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msg->msg_name = SAS2SA(&addrbufs[nbufs]);
+        msg->msg_namelen = addrbuflen;
+        msg->msg_iov = &iovs[nbufs];
+        msg->msg_iovlen = 1;
+        if (controlstride > 0) {
+            msg->msg_control = controlbufs + nbufs * controlstride;
+            msg->msg_controllen = ancbufsize;
+        }
+    }
+
+    /* Make the system call. */
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    if ((retval = PyList_New(ctx.result)) == NULL)
+        goto err_closefds;
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *msg = &msgvec[i].msg_hdr;
+        PyObject *cmsg_list, *item;
+
+        if ((cmsg_list = make_cmsg_list(msg)) == NULL)
+            goto err_closefds;
+        item = Py_BuildValue("nNiN",
+                             (Py_ssize_t)msgvec[i].msg_len,
+                             cmsg_list,
+                             (int)msg->msg_flags,
+                             makesockaddr(s->sock_fd, SAS2SA(&addrbufs[i]),
+                                          ((msg->msg_namelen > addrbuflen) ?
+                                           addrbuflen : msg->msg_namelen),
+                                          s->sock_proto));
+        if (item == NULL)
+            goto err_closefds;
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(controlbufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+
+err_closefds:
+    Py_CLEAR(retval);
+    for (i = 0; i < ctx.result; i++)
+        close_cmsg_fds(&msgvec[i].msg_hdr);
+    goto finally;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffers[, ancbufsize[, flags]]) -> [(nbytes, ancdata, msg_flags, address), ...]\n\
+\n\
+Receive several datagrams from the socket with a single system call,\n\
+each one into the next buffer of buffers.  The buffers argument must be\n\
+a sequence of objects that export writable buffers (e.g. bytearray\n\
+objects).  The ancbufsize argument sets the size in bytes of the\n\
+ancillary data buffer of each datagram and defaults to 0, so that no\n\
+ancillary data is received.  The flags argument defaults to 0 and has\n\
+the same meaning as for recv(); on a blocking socket, pass\n\
+MSG_WAITFORONE to return as soon as one datagram was received instead\n\
+of waiting to fill all the buffers.\n\
+\n\
+Return a list with one (nbytes, ancdata, msg_flags, address) tuple for\n\
+each datagram received, in the order of the buffers which were filled,\n\
+with the same items as recvmsg_into().  A datagram larger than its\n\
+buffer is truncated.");
+#endif    /* HAVE_RECVMMSG && CMSG_LEN */
+
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/* s.sendmmsg(buffers[, flags[, address]]) method */
+
+static PyObject *
+sock_sendmmsg(PySocketSockObject *s, PyObject *args)
+{
+    int addrlen, flags = 0;
+    sock_addr_t addrbuf;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    Py_buffer *bufs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    PyObject *data_arg, *addr_arg = NULL, *fast = NULL, *retval = NULL;
+    struct sock_sendmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|iO:sendmmsg",
+                          &data_arg, &flags, &addr_arg)) {
+        return NULL;
+    }
+
+    /* Parse destination address. */
+    if (addr_arg != NULL && addr_arg != Py_None) {
+        if (!getsockaddrarg(s, addr_arg, &addrbuf, &addrlen, "sendmmsg")) {
+            return NULL;
+        }
+        if (PySys_Audit("socket.sendmmsg", "OO", s, addr_arg) < 0) {
+            return NULL;
+        }
+    } else {
+        if (PySys_Audit("socket.sendmmsg", "OO", s, Py_None) < 0) {
+            return NULL;
+        }
+    }
+
+    if ((fast = PySequence_Fast(data_arg,
+                                "sendmmsg() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    /* Fill in a message header with a single iovec for each datagram,
+       and save the Py_buffer structs to release afterwards. */
+    msgvec = PyMem_Calloc(nitems, sizeof(struct mmsghdr));
+    iovs = PyMem_New(struct iovec, nitems);
+    bufs = PyMem_New(Py_buffer, nitems);
+    if (msgvec == NULL || iovs == NULL || bufs == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    for (; nbufs < nitems; nbufs++) {
+        struct msghdr *msg = &msgvec[nbufs].msg_hdr;
+
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "y*;sendmmsg() argument 1 must be an iterable of "
+                         "bytes-like objects",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        if (addr_arg != NULL && addr_arg != Py_None) {
+            msg->msg_name = &addrbuf;
+            msg->msg_namelen = addrlen;
+        }
+        msg->msg_iov = &iovs[nbufs];
+        msg->msg_iovlen = 1;
+    }
+
+    /* Make the system call. */
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(buffers[, flags[, address]]) -> count\n\
+\n\
+Send each item of buffers, an iterable of bytes-like objects, as a\n\
+separate datagram with a single system call.  The flags argument\n\
+defaults to 0 and has the same meaning as for send().  If address is\n\
+supplied and not None, it sets the destination address of all the\n\
+datagrams.  Return the number of datagrams sent, which can be less\n\
+than the number of buffers.");
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SHUTDOWN
 /* s.shutdown(how) method */
 
@@ -5149,6 +5482,14 @@ static PyMethodDef sock_methods[] = {
 #ifdef HAVE_SOCKADDR_ALG
     {"sendmsg_afalg",     _PyCFunction_CAST(sock_sendmsg_afalg), METH_VARARGS | METH_KEYWORDS,
                       sendmsg_afalg_doc},
+#endif
+#if defined(HAVE_RECVMMSG) && defined(CMSG_LEN)
+    {"recvmmsg_into",     (PyCFunction)sock_recvmmsg_into, METH_VARARGS,
+                      recvmmsg_into_doc},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg",          (PyCFunction)sock_sendmmsg, METH_VARARGS,
+                      sendmmsg_doc},
 #endif
     {NULL,                      NULL}           /* sentinel */
 };
@@ -7760,6 +8101,9 @@ PyInit__socket(void)
 #ifdef SO_INCOMING_CPU
     PyModule_AddIntMacro(m, SO_INCOMING_CPU);
 #endif
+#ifdef SO_ZEROCOPY
+    PyModule_AddIntMacro(m, SO_ZEROCOPY);
+#endif
 
 #ifdef  SO_KEEPALIVE
     PyModule_AddIntMacro(m, SO_KEEPALIVE);
@@ -7940,6 +8284,20 @@ PyInit__socket(void)
 #ifdef MSG_FASTOPEN
     PyModule_AddIntMacro(m, MSG_FASTOPEN);
 #endif
+#ifdef  MSG_WAITFORONE
+    PyModule_AddIntMacro(m, MSG_WAITFORONE);
+#endif
+#ifdef  MSG_ZEROCOPY
+    PyModule_AddIntMacro(m, MSG_ZEROCOPY);
+#endif
+
+    /* Origin and code of the MSG_ZEROCOPY completions read with MSG_ERRQUEUE */
+#ifdef  SO_EE_ORIGIN_ZEROCOPY
+    PyModule_AddIntMacro(m, SO_EE_ORIGIN_ZEROCOPY);
+#endif
+#ifdef  SO_EE_CODE_ZEROCOPY_COPIED
+    PyModule_AddIntMacro(m, SO_EE_CODE_ZEROCOPY_COPIED);
+#endif
 
     /* Protocol level and numbers, usable for [gs]etsockopt */
 #ifdef  SOL_SOCKET
@@ -8155,6 +8513,17 @@ PyInit__socket(void)
     #endif
     PyModule_AddIntMacro(m, UDPLITE_RECV_CSCOV);
 #endif
+#ifdef __linux__
+    /* UDP generic segmentation and receive offload, see udp(7) */
+    #ifndef UDP_SEGMENT
+        #define UDP_SEGMENT 103
+    #endif
+    PyModule_AddIntMacro(m, UDP_SEGMENT);
+    #ifndef UDP_GRO
+        #define UDP_GRO 104
+    #endif
+    PyModule_AddIntMacro(m, UDP_GRO);
+#endif
 #ifdef  IPPROTO_IDP
     PyModule_AddIntMacro(m, IPPROTO_IDP);
 #endif
@@ -8318,6 +8687,9 @@ PyInit__socket(void)
 #ifdef  IP_RECVTOS
     PyModule_AddIntMacro(m, IP_RECVTOS);
 #endif
+#ifdef  IP_RECVERR
+    PyModule_AddIntMacro(m, IP_RECVERR);
+#endif
 #ifdef  IP_RECVDSTADDR
     PyModule_AddIntMacro(m, IP_RECVDSTADDR);
 #endif
@@ -8415,6 +8787,9 @@ PyInit__socket(void)
 #ifdef IPV6_RECVPKTINFO
     PyModule_AddIntMacro(m, IPV6_RECVPKTINFO);
 #endif
+#ifdef IPV6_RECVERR
+    PyModule_AddIntMacro(m, IPV6_RECVERR);
+#endif
 #ifdef IPV6_RECVRTHDR
     PyModule_AddIntMacro(m, IPV6_RECVRTHDR);
 #endif
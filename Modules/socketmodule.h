@@ -102,6 +102,10 @@ typedef int socklen_t;
 #  undef AF_NETLINK
 #endif
 
+#ifdef HAVE_LINUX_ERRQUEUE_H
+# include <linux/errqueue.h>
+#endif
+
 #ifdef HAVE_LINUX_QRTR_H
 # ifdef HAVE_ASM_TYPES_H
 #  include <asm/types.h>
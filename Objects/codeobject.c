@@ -128,7 +128,9 @@ intern_string_constants(PyObject *tuple, int *modified)
                 return -1;
             }
 
-            if (all_name_chars(v)) {
+            /* marshal already interned the strings that were interned
+               when the code was compiled */
+            if (!PyUnicode_CHECK_INTERNED(v) && all_name_chars(v)) {
                 PyObject *w = v;
                 PyUnicode_InternInPlace(&v);
                 if (w != v) {
@@ -2315,6 +2317,10 @@ _PyStaticCode_Init(PyCodeObject *co)
     if (res < 0) {
         return -1;
     }
+    if (co->co_version == 0 && _Py_next_func_version != 0) {
+        /* Code deep-frozen outside of the core leaves the version to us. */
+        co->co_version = _Py_next_func_version++;
+    }
     _PyCode_Quicken(co);
     return 0;
 }
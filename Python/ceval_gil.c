@@ -7,6 +7,7 @@
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_interp.h"        // _Py_RunGC()
 #include "pycore_pymem.h"         // _PyMem_IsPtrFreed()
+#include "pydtrace.h"             // PyDTrace_GIL_ACQUIRE()
 
 /*
    Notes about the implementation:
@@ -47,6 +48,28 @@
      run and end up being the first to re-acquire it, making the "timeslices"
      much longer than expected.
      (Note: this mechanism is enabled with FORCE_SWITCHING above)
+
+   - A thread which released the GIL on its own, typically to block on I/O,
+     before anyone asked for it is considered I/O-bound. When such a thread
+     wants the GIL back, it only waits `interval / GIL_PRIORITY_RATIO`
+     before setting gil_drop_request. Otherwise, a CPU-bound thread would
+     add a whole switch interval to the latency of every I/O completion
+     (the "convoy effect"). A thread which still holds the GIL when a drop
+     request arrives loses that priority until it releases the GIL
+     voluntarily again, so CPU-bound threads keep the regular interval.
+     The GIL is handed over to waiting I/O-bound threads first: the others
+     don't take it while gil->priority_waiters is non-zero.
+     The shorter wait only applies while the GIL is held by a thread known
+     to be CPU-bound (gil->holder_cpu_bound): an I/O-bound holder is about
+     to release it anyway, and arming a timer shorter than the scheduler
+     tick on every handoff is costly, especially in virtual machines.
+
+   - Each thread and each interpreter count GIL acquisitions, the time
+     spent waiting for the GIL and the releases made while a drop request
+     was pending. Measuring how long the GIL is held needs two clock reads
+     per acquisition, so it is only done when enabled with
+     sys._set_gil_timing() or when the gil__release probe is enabled.
+     The gil__acquire and gil__release probes report the same events.
 */
 
 // GH-89279: Force inlining by using a macro.
@@ -203,6 +226,9 @@ is_tstate_valid(PyThreadState *tstate)
 #define COND_SIGNAL(cond) \
     if (PyCOND_SIGNAL(&(cond))) { \
         Py_FatalError("PyCOND_SIGNAL(" #cond ") failed"); };
+#define COND_BROADCAST(cond) \
+    if (PyCOND_BROADCAST(&(cond))) { \
+        Py_FatalError("PyCOND_BROADCAST(" #cond ") failed"); };
 #define COND_WAIT(cond, mut) \
     if (PyCOND_WAIT(&(cond), &(mut))) { \
         Py_FatalError("PyCOND_WAIT(" #cond ") failed"); };
@@ -219,6 +245,7 @@ is_tstate_valid(PyThreadState *tstate)
 
 
 #define DEFAULT_INTERVAL 5000
+#define GIL_PRIORITY_RATIO 20
 
 static void _gil_initialize(struct _gil_runtime_state *gil)
 {
@@ -243,6 +270,8 @@ static void create_gil(struct _gil_runtime_state *gil)
     COND_INIT(gil->switch_cond);
 #endif
     _Py_atomic_store_relaxed(&gil->last_holder, 0);
+    gil->priority_waiters = 0;
+    gil->holder_cpu_bound = 0;
     _Py_ANNOTATE_RWLOCK_CREATE(&gil->locked);
     _Py_atomic_store_explicit(&gil->locked, 0, _Py_memory_order_release);
 }
@@ -272,6 +301,73 @@ static void recreate_gil(struct _gil_runtime_state *gil)
 }
 #endif
 
+static void
+gil_stats_add_hold(_PyGILStats *stats, int64_t hold_ns)
+{
+    int i = 0;
+    int64_t bound = 1000;
+    while (i < _Py_GIL_HOLD_HISTOGRAM_SIZE - 1 && hold_ns >= bound) {
+        bound *= 10;
+        i++;
+    }
+    stats->hold_ns += hold_ns;
+    stats->hold_histogram[i]++;
+}
+
+/* Called with the GIL held, once it has been acquired by tstate. */
+static void
+gil_stats_acquired(struct _gil_runtime_state *gil, PyThreadState *tstate,
+                   _PyTime_t wait_start)
+{
+    _PyGILStats *interp_stats = &tstate->interp->gil_stats;
+    _PyTime_t now = 0;
+    int64_t wait_ns = 0;
+
+    tstate->gil_stats.acquisitions++;
+    interp_stats->acquisitions++;
+    if (wait_start != 0) {
+        now = _PyTime_GetPerfCounter();
+        wait_ns = _PyTime_AsNanoseconds(now - wait_start);
+        tstate->gil_stats.wait_ns += wait_ns;
+        interp_stats->wait_ns += wait_ns;
+    }
+
+    if (gil->timing || PyDTrace_GIL_RELEASE_ENABLED()) {
+        tstate->gil_hold_start = now ? now : _PyTime_GetPerfCounter();
+    }
+    else {
+        tstate->gil_hold_start = 0;
+    }
+
+    if (PyDTrace_GIL_ACQUIRE_ENABLED()) {
+        PyDTrace_GIL_ACQUIRE(tstate->thread_id, wait_ns);
+    }
+}
+
+/* Called with the GIL held, before tstate releases it. */
+static void
+gil_stats_released(PyThreadState *tstate, int forced)
+{
+    _PyGILStats *interp_stats = &tstate->interp->gil_stats;
+    int64_t hold_ns = -1;
+
+    if (forced) {
+        tstate->gil_stats.forced_drops++;
+        interp_stats->forced_drops++;
+    }
+    if (tstate->gil_hold_start != 0) {
+        hold_ns = _PyTime_AsNanoseconds(
+            _PyTime_GetPerfCounter() - tstate->gil_hold_start);
+        tstate->gil_hold_start = 0;
+        gil_stats_add_hold(&tstate->gil_stats, hold_ns);
+        gil_stats_add_hold(interp_stats, hold_ns);
+    }
+
+    if (PyDTrace_GIL_RELEASE_ENABLED()) {
+        PyDTrace_GIL_RELEASE(tstate->thread_id, hold_ns, forced);
+    }
+}
+
 static void
 drop_gil(struct _ceval_runtime_state *ceval, struct _ceval_state *ceval2,
          PyThreadState *tstate)
@@ -287,12 +383,21 @@ drop_gil(struct _ceval_runtime_state *ceval, struct _ceval_state *ceval2,
            under our feet using PyThreadState_Swap(). Fix the GIL last
            holder variable so that our heuristics work. */
         _Py_atomic_store_relaxed(&gil->last_holder, (uintptr_t)tstate);
+        int forced = _Py_atomic_load_relaxed(&ceval2->gil_drop_request);
+        tstate->gil_cpu_bound = forced;
+        gil_stats_released(tstate, forced);
     }
 
     MUTEX_LOCK(gil->mutex);
     _Py_ANNOTATE_RWLOCK_RELEASED(&gil->locked, /*is_write=*/1);
     _Py_atomic_store_relaxed(&gil->locked, 0);
-    COND_SIGNAL(gil->cond);
+    if (gil->priority_waiters) {
+        /* Make sure that an I/O-bound thread is woken up */
+        COND_BROADCAST(gil->cond);
+    }
+    else {
+        COND_SIGNAL(gil->cond);
+    }
     MUTEX_UNLOCK(gil->mutex);
 
 #ifdef FORCE_SWITCHING
@@ -367,15 +472,33 @@ take_gil(PyThreadState *tstate)
 
     MUTEX_LOCK(gil->mutex);
 
-    if (!_Py_atomic_load_relaxed(&gil->locked)) {
+    /* Read tstate before waiting: it can be freed meanwhile if
+       Py_Finalize() is called. */
+    int priority = !tstate->gil_cpu_bound;
+    _PyTime_t wait_start = 0;
+    if (!_Py_atomic_load_relaxed(&gil->locked)
+        && (priority || !gil->priority_waiters))
+    {
         goto _ready;
     }
 
+    wait_start = _PyTime_GetPerfCounter();
+    if (priority) {
+        gil->priority_waiters++;
+    }
     int drop_requested = 0;
-    while (_Py_atomic_load_relaxed(&gil->locked)) {
+    while (_Py_atomic_load_relaxed(&gil->locked)
+           || (!priority && gil->priority_waiters))
+    {
         unsigned long saved_switchnum = gil->switch_number;
 
-        unsigned long interval = (gil->interval >= 1 ? gil->interval : 1);
+        unsigned long interval = gil->interval;
+        if (priority && gil->holder_cpu_bound) {
+            interval /= GIL_PRIORITY_RATIO;
+        }
+        if (interval < 1) {
+            interval = 1;
+        }
         int timed_out = 0;
         COND_TIMED_WAIT(gil->cond, gil->mutex, interval, timed_out);
 
@@ -386,6 +509,9 @@ take_gil(PyThreadState *tstate)
             gil->switch_number == saved_switchnum)
         {
             if (tstate_must_exit(tstate)) {
+                if (priority) {
+                    gil->priority_waiters--;
+                }
                 MUTEX_UNLOCK(gil->mutex);
                 // gh-96387: If the loop requested a drop request in a previous
                 // iteration, reset the request. Otherwise, drop_gil() can
@@ -404,6 +530,9 @@ take_gil(PyThreadState *tstate)
             drop_requested = 1;
         }
     }
+    if (priority) {
+        gil->priority_waiters--;
+    }
 
 _ready:
 #ifdef FORCE_SWITCHING
@@ -413,6 +542,7 @@ take_gil(PyThreadState *tstate)
 #endif
     /* We now hold the GIL */
     _Py_atomic_store_relaxed(&gil->locked, 1);
+    gil->holder_cpu_bound = !priority;
     _Py_ANNOTATE_RWLOCK_ACQUIRED(&gil->locked, /*is_write=*/1);
 
     if (tstate != (PyThreadState*)_Py_atomic_load_relaxed(&gil->last_holder)) {
@@ -434,11 +564,15 @@ take_gil(PyThreadState *tstate)
            in take_gil() while the main thread called
            wait_for_thread_shutdown() from Py_Finalize(). */
         MUTEX_UNLOCK(gil->mutex);
-        drop_gil(ceval, ceval2, tstate);
+        /* tstate could be a dangling pointer, so don't pass it to
+           drop_gil(). */
+        drop_gil(ceval, ceval2, NULL);
         PyThread_exit_thread();
     }
     assert(is_tstate_valid(tstate));
 
+    gil_stats_acquired(gil, tstate, wait_start);
+
     if (_Py_atomic_load_relaxed(&ceval2->gil_drop_request)) {
         RESET_GIL_DROP_REQUEST(interp);
     }
@@ -473,6 +607,18 @@ unsigned long _PyEval_GetSwitchInterval()
     return gil->interval;
 }
 
+void _PyEval_SetGILTiming(int enabled)
+{
+    struct _gil_runtime_state *gil = &_PyRuntime.ceval.gil;
+    gil->timing = enabled;
+}
+
+int _PyEval_GetGILTiming(void)
+{
+    struct _gil_runtime_state *gil = &_PyRuntime.ceval.gil;
+    return gil->timing;
+}
+
 
 int
 _PyEval_ThreadsInitialized(_PyRuntimeState *runtime)
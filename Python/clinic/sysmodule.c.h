@@ -995,6 +995,70 @@ sys__current_exceptions(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__current_exceptions_impl(module);
 }
 
+PyDoc_STRVAR(sys__get_gil_stats__doc__,
+"_get_gil_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dict of GIL statistics of the current interpreter.\n"
+"\n"
+"The dict has the following keys:\n"
+"\n"
+"  acquisitions -- number of times the GIL was taken\n"
+"  forced_drops -- number of times the GIL was released while another\n"
+"                  thread was asking for it\n"
+"  wait_ns -- total time spent waiting to take the GIL, in nanoseconds\n"
+"  hold_ns -- total time the GIL was held, in nanoseconds\n"
+"  hold_histogram -- tuple of the number of times the GIL was held for\n"
+"                    less than 1 us, 10 us, 100 us, 1 ms, 10 ms, 100 ms\n"
+"                    and for longer\n"
+"  threads -- dict mapping each thread\'s identifier to a dict of the\n"
+"             same statistics for that thread\n"
+"  timing -- whether hold_ns and hold_histogram are being measured\n"
+"\n"
+"This function should be used for specialized purposes only.");
+
+#define SYS__GET_GIL_STATS_METHODDEF    \
+    {"_get_gil_stats", (PyCFunction)sys__get_gil_stats, METH_NOARGS, sys__get_gil_stats__doc__},
+
+static PyObject *
+sys__get_gil_stats_impl(PyObject *module);
+
+static PyObject *
+sys__get_gil_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_gil_stats_impl(module);
+}
+
+PyDoc_STRVAR(sys__set_gil_timing__doc__,
+"_set_gil_timing($module, enabled, /)\n"
+"--\n"
+"\n"
+"Enable or disable measuring how long threads hold the GIL.\n"
+"\n"
+"This function should be used for specialized purposes only.");
+
+#define SYS__SET_GIL_TIMING_METHODDEF    \
+    {"_set_gil_timing", (PyCFunction)sys__set_gil_timing, METH_O, sys__set_gil_timing__doc__},
+
+static PyObject *
+sys__set_gil_timing_impl(PyObject *module, int enabled);
+
+static PyObject *
+sys__set_gil_timing(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int enabled;
+
+    enabled = PyObject_IsTrue(arg);
+    if (enabled < 0) {
+        goto exit;
+    }
+    return_value = sys__set_gil_timing_impl(module, enabled);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys_call_tracing__doc__,
 "call_tracing($module, func, args, /)\n"
 "--\n"
@@ -1318,4 +1382,4 @@ sys_is_stack_trampoline_active(PyObject *module, PyObject *Py_UNUSED(ignored))
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=b32b444538dfd354 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=af73e191c7c4d3fe input=a9049054013a1b77]*/
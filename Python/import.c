@@ -1386,7 +1386,8 @@ unmarshal_frozen_code(struct frozen_info *info)
 {
     if (info->get_code) {
         PyObject *code = info->get_code();
-        assert(code != NULL);
+        /* Deep-frozen application modules are initialized lazily. */
+        assert(code != NULL || PyErr_Occurred());
         return code;
     }
     PyObject *co = PyMarshal_ReadObjectFromString(info->data, info->size);
@@ -129,7 +129,11 @@ The following implementation-specific options are available:\n\
 \n\
 -X int_max_str_digits=number: limit the size of int<->str conversions.\n\
     This helps avoid denial of service attacks when parsing untrusted data.\n\
-    The default is sys.int_info.default_max_str_digits.  0 disables."
+    The default is sys.int_info.default_max_str_digits.  0 disables.\n\
+\n\
+-X lazy_imports[=module1,module2,...]: only execute the code of modules\n\
+    imported from sys.path when their attributes are first accessed, except\n\
+    for the listed modules and their submodules."
 
 #ifdef Py_STATS
 "\n\
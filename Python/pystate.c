@@ -1522,6 +1522,91 @@ _PyThread_CurrentExceptions(void)
     return result;
 }
 
+static PyObject *
+gil_stats_as_dict(const _PyGILStats *stats)
+{
+    PyObject *histogram = PyTuple_New(_Py_GIL_HOLD_HISTOGRAM_SIZE);
+    if (histogram == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < _Py_GIL_HOLD_HISTOGRAM_SIZE; i++) {
+        PyObject *count = PyLong_FromUnsignedLongLong(
+            stats->hold_histogram[i]);
+        if (count == NULL) {
+            Py_DECREF(histogram);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(histogram, i, count);
+    }
+    return Py_BuildValue("{sKsKsLsLsN}",
+                         "acquisitions",
+                         (unsigned long long)stats->acquisitions,
+                         "forced_drops",
+                         (unsigned long long)stats->forced_drops,
+                         "wait_ns", (long long)stats->wait_ns,
+                         "hold_ns", (long long)stats->hold_ns,
+                         "hold_histogram", histogram);
+}
+
+PyObject *
+_PyThread_GetGILStats(void)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+
+    _Py_EnsureTstateNotNULL(tstate);
+
+    PyInterpreterState *interp = tstate->interp;
+    PyObject *result = gil_stats_as_dict(&interp->gil_stats);
+    if (result == NULL) {
+        return NULL;
+    }
+    PyObject *threads = PyDict_New();
+    if (threads == NULL) {
+        goto fail;
+    }
+    int res = PyDict_SetItemString(result, "threads", threads);
+    Py_DECREF(threads);
+    if (res < 0) {
+        goto fail;
+    }
+    if (PyDict_SetItemString(result, "timing",
+                             _PyEval_GetGILTiming() ? Py_True : Py_False) < 0)
+    {
+        goto fail;
+    }
+
+    /* The thread list can mutate even when the GIL is held, so we need to
+       grab head_mutex for the duration. */
+    _PyRuntimeState *runtime = interp->runtime;
+    HEAD_LOCK(runtime);
+    PyThreadState *t;
+    for (t = interp->threads.head; t != NULL; t = t->next) {
+        PyObject *id = PyLong_FromUnsignedLong(t->thread_id);
+        if (id == NULL) {
+            goto fail_locked;
+        }
+        PyObject *stats = gil_stats_as_dict(&t->gil_stats);
+        if (stats == NULL) {
+            Py_DECREF(id);
+            goto fail_locked;
+        }
+        int stat = PyDict_SetItem(threads, id, stats);
+        Py_DECREF(id);
+        Py_DECREF(stats);
+        if (stat < 0) {
+            goto fail_locked;
+        }
+    }
+    HEAD_UNLOCK(runtime);
+    return result;
+
+fail_locked:
+    HEAD_UNLOCK(runtime);
+fail:
+    Py_DECREF(result);
+    return NULL;
+}
+
 /* Python "auto thread state" API. */
 
 /* Keep this as a static, as it is not reliable!  It can only
@@ -1938,6 +1938,54 @@ sys__current_exceptions_impl(PyObject *module)
     return _PyThread_CurrentExceptions();
 }
 
+/*[clinic input]
+sys._get_gil_stats
+
+Return a dict of GIL statistics of the current interpreter.
+
+The dict has the following keys:
+
+  acquisitions -- number of times the GIL was taken
+  forced_drops -- number of times the GIL was released while another
+                  thread was asking for it
+  wait_ns -- total time spent waiting to take the GIL, in nanoseconds
+  hold_ns -- total time the GIL was held, in nanoseconds
+  hold_histogram -- tuple of the number of times the GIL was held for
+                    less than 1 us, 10 us, 100 us, 1 ms, 10 ms, 100 ms
+                    and for longer
+  threads -- dict mapping each thread's identifier to a dict of the
+             same statistics for that thread
+  timing -- whether hold_ns and hold_histogram are being measured
+
+This function should be used for specialized purposes only.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_gil_stats_impl(PyObject *module)
+/*[clinic end generated code: output=5e1e06e95f9cd81f input=7f5088cd51eb1ebd]*/
+{
+    return _PyThread_GetGILStats();
+}
+
+/*[clinic input]
+sys._set_gil_timing
+
+    enabled: bool
+    /
+
+Enable or disable measuring how long threads hold the GIL.
+
+This function should be used for specialized purposes only.
+[clinic start generated code]*/
+
+static PyObject *
+sys__set_gil_timing_impl(PyObject *module, int enabled)
+/*[clinic end generated code: output=7fbfea04e96ecea8 input=93ef8f0ed34dfe85]*/
+{
+    _PyEval_SetGILTiming(enabled);
+    Py_RETURN_NONE;
+}
+
 /*[clinic input]
 sys.call_tracing
 
@@ -2184,6 +2232,8 @@ static PyMethodDef sys_methods[] = {
     SYS__CLEAR_TYPE_CACHE_METHODDEF
     SYS__CURRENT_FRAMES_METHODDEF
     SYS__CURRENT_EXCEPTIONS_METHODDEF
+    SYS__GET_GIL_STATS_METHODDEF
+    SYS__SET_GIL_TIMING_METHODDEF
     SYS_DISPLAYHOOK_METHODDEF
     SYS_EXCEPTION_METHODDEF
     SYS_EXC_INFO_METHODDEF
@@ -157,7 +157,9 @@ PyThread_GetInfo(void)
 #ifdef HAVE_PTHREAD_STUBS
     value = Py_NewRef(Py_None);
 #elif defined(_POSIX_THREADS)
-#ifdef USE_SEMAPHORES
+#if defined(USE_FUTEX_LOCKS)
+    value = PyUnicode_FromString("futex");
+#elif defined(USE_SEMAPHORES)
     value = PyUnicode_FromString("semaphore");
 #else
     value = PyUnicode_FromString("mutex+cond");
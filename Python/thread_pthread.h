@@ -102,6 +102,18 @@
 #  undef USE_SEMAPHORES
 #endif
 
+/* On Linux, build locks directly on futexes: an uncontended acquire or
+ * release is a single atomic instruction, and a contended one costs one
+ * system call, instead of going through a semaphore or a mutex and
+ * condition variable pair.
+ */
+#if (defined(__linux__) && defined(HAVE_LINUX_FUTEX_H) && \
+     defined(SYS_futex) && defined(HAVE_BUILTIN_ATOMIC))
+#  include <linux/futex.h>
+#  include <errno.h>
+#  define USE_FUTEX_LOCKS
+#endif
+
 
 /* On platforms that don't use standard POSIX threads pthread_sigmask()
  * isn't present.  DEC threads uses sigprocmask() instead as do most
@@ -359,7 +371,172 @@ PyThread_exit_thread(void)
     pthread_exit(0);
 }
 
-#ifdef USE_SEMAPHORES
+#if defined(USE_FUTEX_LOCKS)
+
+/*
+ * Lock support.
+ *
+ * A futex lock is a single int which is 0 when unlocked, 1 when locked and
+ * 2 when locked with threads possibly sleeping in futex_wait(): see
+ * "Futexes Are Tricky" by Ulrich Drepper.  Like any Python lock, it can be
+ * released by a thread other than the one which acquired it.
+ */
+
+#define FUTEX_UNLOCKED  0
+#define FUTEX_LOCKED    1
+#define FUTEX_CONTENDED 2
+
+/* Number of times a contended acquire polls the lock before sleeping.
+   Python locks are often held for a short time (ex: the mutex of a
+   queue.Queue), in which case spinning saves two system calls and a
+   context switch. */
+#define FUTEX_SPIN_COUNT 100
+
+typedef struct {
+    int value;
+} futex_lock;
+
+/* Return the previous value of *addr */
+static inline int
+futex_compare_exchange(int *addr, int expected, int desired)
+{
+    __atomic_compare_exchange_n(addr, &expected, desired, 0,
+                                __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    return expected;
+}
+
+static inline void
+futex_cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __asm__ __volatile__("pause");
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/* Sleep while *addr is equal to expected, for at most timeout if it is
+   not negative.  Return 0 or an errno value. */
+static int
+futex_wait(int *addr, int expected, _PyTime_t timeout)
+{
+    struct timespec ts, *pts = NULL;
+    if (timeout >= 0) {
+        _PyTime_AsTimespec_clamp(timeout, &ts);
+        pts = &ts;
+    }
+    if (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected,
+                pts, NULL, 0) < 0) {
+        return errno;
+    }
+    return 0;
+}
+
+static void
+futex_wake(int *addr)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+PyThread_type_lock
+PyThread_allocate_lock(void)
+{
+    futex_lock *lock;
+
+    if (!initialized)
+        PyThread_init_thread();
+
+    lock = (futex_lock *)PyMem_RawMalloc(sizeof(futex_lock));
+    if (lock) {
+        lock->value = FUTEX_UNLOCKED;
+    }
+    return (PyThread_type_lock)lock;
+}
+
+void
+PyThread_free_lock(PyThread_type_lock lock)
+{
+    PyMem_RawFree(lock);
+}
+
+PyLockStatus
+PyThread_acquire_lock_timed(PyThread_type_lock lock, PY_TIMEOUT_T microseconds,
+                            int intr_flag)
+{
+    futex_lock *thelock = (futex_lock *)lock;
+    int *value = &thelock->value;
+
+    int c = futex_compare_exchange(value, FUTEX_UNLOCKED, FUTEX_LOCKED);
+    if (c == FUTEX_UNLOCKED) {
+        return PY_LOCK_ACQUIRED;
+    }
+    if (microseconds == 0) {
+        return PY_LOCK_FAILURE;
+    }
+
+    /* Only spin while no thread sleeps on the lock, so that a newcomer
+       doesn't keep overtaking the thread woken up by the release. */
+    for (int i = 0; c == FUTEX_LOCKED && i < FUTEX_SPIN_COUNT; i++) {
+        futex_cpu_relax();
+        c = __atomic_load_n(value, __ATOMIC_RELAXED);
+        if (c == FUTEX_UNLOCKED) {
+            c = futex_compare_exchange(value, FUTEX_UNLOCKED, FUTEX_LOCKED);
+            if (c == FUTEX_UNLOCKED) {
+                return PY_LOCK_ACQUIRED;
+            }
+        }
+    }
+
+    _PyTime_t timeout = -1;  // relative timeout, negative means forever
+    _PyTime_t deadline = 0;
+    if (microseconds > 0) {
+        // See the semaphore implementation below about clamping.
+        timeout = _PyTime_FromMicrosecondsClamp(microseconds);
+        deadline = _PyDeadline_Init(timeout);
+    }
+
+    while (1) {
+        /* Mark the lock as contended, so that the thread releasing it
+           wakes us up. */
+        if (__atomic_exchange_n(value, FUTEX_CONTENDED,
+                                __ATOMIC_ACQUIRE) == FUTEX_UNLOCKED) {
+            return PY_LOCK_ACQUIRED;
+        }
+        if (timeout == 0) {
+            return PY_LOCK_FAILURE;
+        }
+
+        int err = futex_wait(value, FUTEX_CONTENDED, timeout);
+        if (err == EINTR && intr_flag) {
+            return PY_LOCK_INTR;
+        }
+        if (err != 0 && err != EINTR && err != EAGAIN && err != ETIMEDOUT) {
+            errno = err;
+            perror("futex_wait");
+            return PY_LOCK_FAILURE;
+        }
+
+        if (deadline) {
+            timeout = _PyDeadline_Get(deadline);
+            if (timeout < 0) {
+                timeout = 0;
+            }
+        }
+    }
+}
+
+void
+PyThread_release_lock(PyThread_type_lock lock)
+{
+    futex_lock *thelock = (futex_lock *)lock;
+
+    if (__atomic_exchange_n(&thelock->value, FUTEX_UNLOCKED,
+                            __ATOMIC_RELEASE) == FUTEX_CONTENDED) {
+        futex_wake(&thelock->value);
+    }
+}
+
+#elif defined(USE_SEMAPHORES)
 
 /*
  * Lock support.
@@ -542,7 +719,7 @@ PyThread_release_lock(PyThread_type_lock lock)
     CHECK_STATUS("sem_post");
 }
 
-#else /* USE_SEMAPHORES */
+#else /* !USE_FUTEX_LOCKS && !USE_SEMAPHORES */
 
 /*
  * Lock support.
@@ -708,7 +885,7 @@ PyThread_release_lock(PyThread_type_lock lock)
     CHECK_STATUS_PTHREAD("pthread_mutex_unlock[3]");
 }
 
-#endif /* USE_SEMAPHORES */
+#endif /* USE_FUTEX_LOCKS */
 
 int
 _PyThread_at_fork_reinit(PyThread_type_lock *lock)
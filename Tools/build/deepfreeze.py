@@ -21,6 +21,8 @@
 
 verbose = False
 identifiers, strings = get_identifiers_and_strings()
+# The global strings are declared as C string literals (e.g. "\\n").
+strings = {ast.literal_eval(f'"{s}"'): name for s, name in strings.items()}
 
 # This must be kept in sync with opcode.py
 RESUME = 151
@@ -110,13 +112,21 @@ def removesuffix(base: str, suffix: str) -> str:
 
 class Printer:
 
-    def __init__(self, file: TextIO) -> None:
+    def __init__(self, file: TextIO, app: bool = False) -> None:
         self.level = 0
         self.file = file
+        self.app = app
         self.cache: Dict[tuple[type, object, str], str] = {}
         self.hits, self.misses = 0, 0
         self.finis: list[str] = []
         self.inits: list[str] = []
+        if app:
+            # Application code is built outside of the core but still needs
+            # the internal headers for the object layouts.
+            self.write("#ifndef Py_BUILD_CORE_BUILTIN")
+            self.write("#  define Py_BUILD_CORE_MODULE 1")
+            self.write("#endif")
+            self.write("")
         self.write('#include "Python.h"')
         self.write('#include "internal/pycore_gc.h"')
         self.write('#include "internal/pycore_code.h"')
@@ -217,9 +227,14 @@ def generate_unicode(self, name: str, s: str) -> str:
                             self.write(f".kind = {kind},")
                             self.write(".compact = 1,")
                             self.write(".ascii = 0,")
-                    utf8 = s.encode('utf-8')
-                    self.write(f'.utf8 = {make_string_literal(utf8)},')
-                    self.write(f'.utf8_length = {len(utf8)},')
+                    try:
+                        utf8 = s.encode('utf-8')
+                    except UnicodeEncodeError:
+                        # Lone surrogates have no UTF-8 representation.
+                        pass
+                    else:
+                        self.write(f'.utf8 = {make_string_literal(utf8)},')
+                        self.write(f'.utf8_length = {len(utf8)},')
                 with self.block(f"._data =", ","):
                     for i in range(0, len(s), 16):
                         data = s[i:i+16]
@@ -270,8 +285,13 @@ def generate_code(self, name: str, code: types.CodeType) -> str:
             self.write(f".co_nplaincellvars = {nplaincellvars},")
             self.write(f".co_ncellvars = {ncellvars},")
             self.write(f".co_nfreevars = {nfreevars},")
-            self.write(f".co_version = {next_code_version},")
-            next_code_version += 1
+            if self.app:
+                # Assigned by _PyStaticCode_Init() on first use, since
+                # the runtime's versions are not known here.
+                self.write(".co_version = 0,")
+            else:
+                self.write(f".co_version = {next_code_version},")
+                next_code_version += 1
             self.write(f".co_localsplusnames = {co_localsplusnames},")
             self.write(f".co_localspluskinds = {co_localspluskinds},")
             self.write(f".co_filename = {co_filename},")
@@ -373,14 +393,33 @@ def generate_frozenset(self, name: str, fs: FrozenSet[object]) -> str:
         return ret
 
     def generate_file(self, module: str, code: object)-> None:
+        if self.app:
+            self.generate_app_file(module, code)
+            return
         module = module.replace(".", "_")
         self.generate(f"{module}_toplevel", code)
         self.write(EPILOGUE.format(name=module))
 
+    def generate_app_file(self, module: str, code: object)-> None:
+        # The code objects of an application module are initialized when
+        # the module is first imported, there is no global init function.
+        module = mangle_app_module(module)
+        start = len(self.inits)
+        self.generate(f"{module}_toplevel", code)
+        self.write(APP_EPILOGUE_HEAD.format(name=module))
+        with self.indent(), self.indent():
+            for p in self.inits[start:]:
+                with self.block(f"if ({p} < 0)"):
+                    self.write("return NULL;")
+        self.write(APP_EPILOGUE_TAIL.format(name=module))
+
     def generate(self, name: str, obj: object) -> str:
         # Use repr() in the key to distinguish -0.0 from +0.0
         key = (type(obj), obj, repr(obj))
-        if key in self.cache:
+        # Equal code objects of different application modules are not
+        # shared, so that each module initializes all of its code objects.
+        if key in self.cache and not (
+                self.app and isinstance(obj, (types.CodeType, umarshal.Code))):
             self.hits += 1
             # print(f"Cache hit {key!r:.40}: {self.cache[key]!r:.40}")
             return self.cache[key]
@@ -425,6 +464,33 @@ def generate(self, name: str, obj: object) -> str:
 }}
 """
 
+APP_EPILOGUE_HEAD = """
+PyObject *
+_PyApp_get_{name}_toplevel(void)
+{{
+    static int initialized = 0;
+    if (!initialized) {{"""
+
+APP_EPILOGUE_TAIL = """\
+        initialized = 1;
+    }}
+    return Py_NewRef((PyObject *) &{name}_toplevel);
+}}
+"""
+
+
+def mangle_app_module(module: str) -> str:
+    return module.replace(".", "__")
+
+
+def app_getter_name(module: str) -> str:
+    """Return the name of the function returning the module's code object.
+
+    Only valid for files generated with app=True.
+    """
+    return f"_PyApp_get_{mangle_app_module(module)}_toplevel"
+
+
 FROZEN_COMMENT_C = "/* Auto-generated by Programs/_freeze_module.c */"
 FROZEN_COMMENT_PY = "/* Auto-generated by Programs/_freeze_module.py */"
 
@@ -446,8 +512,8 @@ def decode_frozen_data(source: str) -> types.CodeType:
     return umarshal.loads(data)
 
 
-def generate(args: list[str], output: TextIO) -> None:
-    printer = Printer(output)
+def generate(args: list[str], output: TextIO, app: bool = False) -> None:
+    printer = Printer(output, app)
     for arg in args:
         file, modname = arg.rsplit(':', 1)
         with open(file, "r", encoding="utf8") as fd:
@@ -455,8 +521,15 @@ def generate(args: list[str], output: TextIO) -> None:
             if is_frozen_header(source):
                 code = decode_frozen_data(source)
             else:
-                code = compile(fd.read(), f"<frozen {modname}>", "exec")
+                code = compile(source, f"<frozen {modname}>", "exec")
             printer.generate_file(modname, code)
+    if not app:
+        generate_runtime_epilogue(printer)
+    if verbose:
+        print(f"Cache hits: {printer.hits}, misses: {printer.misses}")
+
+
+def generate_runtime_epilogue(printer: Printer) -> None:
     with printer.block(f"void\n_Py_Deepfreeze_Fini(void)"):
         for p in printer.finis:
             printer.write(p)
@@ -466,6 +539,20 @@ def generate(args: list[str], output: TextIO) -> None:
                 printer.write("return -1;")
         printer.write("return 0;")
     printer.write(f"\nuint32_t _Py_next_func_version = {next_code_version};\n")
+
+
+def generate_app(modules: Dict[str, object], output: TextIO) -> None:
+    """Deep-freeze the code objects of application modules.
+
+    *modules* maps module names to their code objects, which must have
+    been compiled by the Python version the output is built against.
+    The code object of a module is returned by the function named by
+    app_getter_name(); it can be used as the get_code field of a
+    PyImport_FrozenModules entry.
+    """
+    printer = Printer(output, app=True)
+    for modname, code in modules.items():
+        printer.generate_file(modname, code)
     if verbose:
         print(f"Cache hits: {printer.hits}, misses: {printer.misses}")
 
@@ -473,6 +560,9 @@ def generate(args: list[str], output: TextIO) -> None:
 parser = argparse.ArgumentParser()
 parser.add_argument("-o", "--output", help="Defaults to deepfreeze.c", default="deepfreeze.c")
 parser.add_argument("-v", "--verbose", action="store_true", help="Print diagnostics")
+parser.add_argument("--app", action="store_true",
+                    help="Generate code for modules of an application "
+                         "linked against libpython; see Tools/freeze")
 parser.add_argument('args', nargs="+", help="Input file and module name (required) in file:modname format")
 
 @contextlib.contextmanager
@@ -493,7 +583,7 @@ def main() -> None:
     output = args.output
     with open(output, "w", encoding="utf-8") as file:
         with report_time("generate"):
-            generate(args.args, file)
+            generate(args.args, file, args.app)
     if verbose:
         print(f"Wrote {os.path.getsize(output)} bytes to {output}")
 
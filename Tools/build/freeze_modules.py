@@ -48,10 +48,15 @@
     ('stdlib - startup, without site (python -S)', [
         'abc',
         'codecs',
-        # For now we do not freeze the encodings, due # to the noise all
+        # For now we do not freeze all the encodings, due # to the noise all
         # those extra modules add to the text printed during the build.
         # (See https://github.com/python/cpython/pull/28398#pullrequestreview-756856469.)
+        # Only those needed by every startup are frozen, the others are
+        # still found through encodings.__path__.
         #'<encodings.*>',
+        '<encodings>',
+        'encodings.aliases',
+        'encodings.utf_8',
         'io',
         ]),
     ('stdlib - startup, with site', [
@@ -285,6 +285,16 @@ def _ping():
     finally:
         sock.close()
 
+def _gil_wait_time():
+    # Time spent by the current thread waiting for the GIL, in seconds,
+    # or None if the interpreter doesn't report it.
+    try:
+        get_gil_stats = sys._get_gil_stats
+    except AttributeError:
+        return None
+    stats = get_gil_stats()['threads'][threading.current_thread().ident]
+    return stats['wait_ns'] / 1e9
+
 def run_latency_client(**kwargs):
     cmd_line = [sys.executable, '-E', os.path.abspath(__file__)]
     cmd_line.extend(['--latclient', repr(kwargs)])
@@ -348,10 +358,13 @@ def run():
         started = True
         start_cond.notify(nthreads)
 
+    gil_wait = _gil_wait_time()
     while LAT_END not in s:
         s = _recv(sock, 4096)
         t = _time()
         chunks.append((t, s))
+    if gil_wait is not None:
+        gil_wait = _gil_wait_time() - gil_wait
 
     # Tell the background threads to stop.
     end_event.append(None)
@@ -370,7 +383,7 @@ def run():
                 assert isinstance(send_time, float)
                 results.append((send_time, recv_time))
 
-    return results
+    return results, gil_wait
 
 def run_latency_tests(max_threads):
     for task in latency_tasks:
@@ -379,14 +392,17 @@ def run_latency_tests(max_threads):
         func, args = task()
         nthreads = 0
         while nthreads <= max_threads:
-            results = run_latency_test(func, args, nthreads)
+            results, gil_wait = run_latency_test(func, args, nthreads)
             n = len(results)
             # We print out milliseconds
             lats = [1000 * (t2 - t1) for (t1, t2) in results]
             #print(list(map(int, lats)))
             avg = sum(lats) / n
             dev = (sum((x - avg) ** 2 for x in lats) / n) ** 0.5
-            print("CPU threads=%d: %d ms. (std dev: %d ms.)" % (nthreads, avg, dev), end="")
+            print("CPU threads=%d: %.1f ms. (std dev: %.1f ms.)" % (nthreads, avg, dev), end="")
+            if gil_wait is not None:
+                # Average time the receiving thread waited for the GIL
+                print(" [GIL wait: %.1f ms.]" % (1000 * gil_wait / n), end="")
             print()
             #print("    [... from %d samples]" % n)
             nthreads += 1
@@ -0,0 +1,138 @@
+"""Throughput benchmarks for passing messages between processes.
+
+Each benchmark sends messages from the main process to a child process,
+which receives them all, through one of the multiprocessing channel types:
+multiprocessing.Queue, multiprocessing.SimpleQueue, a Pipe connection and
+multiprocessing.shared_memory.ShareableChannel.  It should not be used as
+an overall benchmark of multiprocessing, but rather as an easy way to
+compare the cost of the channels themselves.
+"""
+
+import argparse
+import multiprocessing
+import time
+from multiprocessing import shared_memory
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+
+def make_bytes(size):
+    return b'x' * size
+
+def make_object(size):
+    return {'id': 42, 'tags': ['spam', 'eggs'], 'payload': b'x' * size}
+
+def make_array(size):
+    return numpy.zeros(size, dtype=numpy.uint8)
+
+PAYLOADS = {
+    'bytes': make_bytes,
+    'object': make_object,
+    'array': make_array,
+}
+
+
+# Each channel type is given as a factory returning (sender, receiver,
+# cleanup).  The sender and receiver are picklable callables.
+
+def queue_channel(ctx, size):
+    q = ctx.Queue()
+    return q.put, q.get, None
+
+def simplequeue_channel(ctx, size):
+    q = ctx.SimpleQueue()
+    return q.put, q.get, None
+
+def pipe_channel(ctx, size):
+    reader, writer = ctx.Pipe(duplex=False)
+    return writer.send, reader.recv, None
+
+def shm_channel(ctx, size):
+    chan = shared_memory.ShareableChannel(size)
+    def cleanup():
+        chan.shm.close()
+        chan.shm.unlink()
+    return chan.send, chan.recv, cleanup
+
+CHANNELS = {
+    'queue': queue_channel,
+    'simplequeue': simplequeue_channel,
+    'pipe': pipe_channel,
+    'shm': shm_channel,
+}
+
+
+def consumer(recv, count, done):
+    for _ in range(count):
+        recv()
+    done.set()
+
+def run(ctx, channel, make_payload, size, count, buffer_size):
+    send, recv, cleanup = CHANNELS[channel](ctx, buffer_size)
+    try:
+        done = ctx.Event()
+        payload = make_payload(size)
+        p = ctx.Process(target=consumer, args=(recv, count, done))
+        p.start()
+        # Make sure the consumer is up before starting the clock.
+        send(payload)
+        count -= 1
+        t0 = time.perf_counter()
+        for _ in range(count):
+            send(payload)
+        done.wait()
+        dt = time.perf_counter() - t0
+        p.join()
+        return dt
+    finally:
+        if cleanup is not None:
+            cleanup()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=20_000,
+                        help='number of messages (default: %(default)s)')
+    parser.add_argument('-s', '--sizes', default='16,1024,65536',
+                        help='comma-separated payload sizes in bytes '
+                             '(default: %(default)s)')
+    parser.add_argument('-p', '--payload', choices=sorted(PAYLOADS),
+                        default='bytes',
+                        help='kind of messages sent (default: %(default)s)')
+    parser.add_argument('-b', '--buffer-size', type=int, default=1 << 22,
+                        help='capacity of the shared memory ring buffer '
+                             '(default: %(default)s)')
+    parser.add_argument('-m', '--start-method', default=None,
+                        help='multiprocessing start method')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='number of runs, the best is reported '
+                             '(default: %(default)s)')
+    parser.add_argument('channels', nargs='*',
+                        help='channels to compare (default: all)')
+    args = parser.parse_args()
+
+    channels = args.channels or list(CHANNELS)
+    for channel in channels:
+        if channel not in CHANNELS:
+            parser.error('unknown channel: %r' % channel)
+    if args.payload == 'array' and numpy is None:
+        parser.error('the array payload requires numpy')
+    ctx = multiprocessing.get_context(args.start_method)
+    sizes = [int(size) for size in args.sizes.split(',')]
+
+    print('%-12s %10s %12s %10s' % ('channel', 'size', 'msg/s', 'MiB/s'))
+    for size in sizes:
+        for channel in channels:
+            dt = min(run(ctx, channel, PAYLOADS[args.payload], size,
+                         args.number, args.buffer_size)
+                     for _ in range(args.repeat))
+            rate = (args.number - 1) / dt
+            print('%-12s %10d %12.0f %10.1f'
+                  % (channel, size, rate, rate * size / 2**20))
+
+
+if __name__ == '__main__':
+    main()
@@ -51,6 +51,12 @@
 -E:           Freeze will fail if any modules can't be found (that
               were not excluded using -x or -X).
 
+-F:           Deep-freeze the modules: their code objects and constants
+              are emitted as statically initialized C data (like the
+              bootstrap modules of the interpreter itself, see
+              Tools/build/deepfreeze.py), so importing them does not
+              need to unmarshal anything.  Not supported on Windows.
+
 -i filename:  Include a file with additional command line options.  Used
               to prevent command lines growing beyond the capabilities of
               the shell/OS.  All arguments specified in filename
@@ -122,6 +128,7 @@ def main():
     win = sys.platform[:3] == 'win'
     replace_paths = []                  # settable with -r option
     error_if_any_missing = 0
+    deep_freeze = 0
 
     # default the exclude list for each platform
     if win: exclude = exclude + [
@@ -155,7 +162,7 @@ def main():
 
     # Now parse the command line with the extras inserted.
     try:
-        opts, args = getopt.getopt(sys.argv[1:], 'r:a:dEe:hmo:p:P:qs:wX:x:l:')
+        opts, args = getopt.getopt(sys.argv[1:], 'r:a:dEFe:hmo:p:P:qs:wX:x:l:')
     except getopt.error as msg:
         usage('getopt error: ' + str(msg))
 
@@ -191,6 +198,8 @@ def main():
             fail_import.append(a)
         if o == '-E':
             error_if_any_missing = 1
+        if o == '-F':
+            deep_freeze = 1
         if o == '-l':
             addn_link.append(a)
         if o == '-a':
@@ -199,6 +208,13 @@ def main():
             f,r = a.split("=", 2)
             replace_paths.append( (f,r) )
 
+    if deep_freeze:
+        if win:
+            usage("-F option not supported on Windows")
+        # deepfreeze lives next to us in the Tools directory
+        sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                     os.pardir, 'build'))
+
     # modules that are imported by the Python runtime
     implicits = []
     for module in ('site', 'warnings', 'encodings.utf_8', 'encodings.latin_1'):
@@ -385,7 +401,7 @@ def main():
 
     # generate output for frozen modules
     files = makefreeze.makefreeze(base, dict, debug, custom_entry_point,
-                                  fail_import)
+                                  fail_import, deep_freeze)
 
     # look for unfrozen modules (builtin and of unknown origin)
     builtins = []
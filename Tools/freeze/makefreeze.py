@@ -4,11 +4,13 @@
 
 # Write a file containing frozen code for the modules in the dictionary.
 
-header = """
+include = """
 #include "Python.h"
-
+"""
+table = """
 static struct _frozen _PyImport_FrozenModules[] = {
 """
+header = include + table
 trailer = """\
     {0, 0, 0} /* sentinel */
 };
@@ -29,11 +31,15 @@
 
 """
 
-def makefreeze(base, dict, debug=0, entry_point=None, fail_import=()):
+def makefreeze(base, dict, debug=0, entry_point=None, fail_import=(),
+               deepfreeze=False):
     if entry_point is None: entry_point = default_entry_point
     done = []
     files = []
     mods = sorted(dict.keys())
+    if deepfreeze:
+        return deepfreezemodules(base, dict, mods, debug, entry_point,
+                                 fail_import)
     for mod in mods:
         m = dict[mod]
         mangled = "__".join(mod.split("."))
@@ -71,6 +77,43 @@ def makefreeze(base, dict, debug=0, entry_point=None, fail_import=()):
 
 
 
+# Deep-freeze the code objects of all modules into a single file: they are
+# statically initialized instead of being unmarshalled on import.  The
+# frozen table refers to them through get_code functions.
+
+def deepfreezemodules(base, dict, mods, debug, entry_point, fail_import):
+    import deepfreeze
+    done = []
+    codes = {}
+    for mod in mods:
+        m = dict[mod]
+        if m.__code__:
+            if debug:
+                print("deep-freezing", mod, "...")
+            codes[mod] = m.__code__
+            is_package = '1' if m.__path__ else '0'
+            done.append((mod, deepfreeze.app_getter_name(mod), is_package))
+    file = 'deepfreeze.c'
+    with bkfile.open(base + file, 'w') as outfp:
+        deepfreeze.generate_app(codes, outfp)
+    if debug:
+        print("generating table of frozen modules")
+    with bkfile.open(base + 'frozen.c', 'w') as outfp:
+        outfp.write(include)
+        for mod, getter, _ in done:
+            outfp.write('extern PyObject *%s(void);\n' % getter)
+        outfp.write(table)
+        for mod, getter, is_package in done:
+            outfp.write('\t{"%s", NULL, 0, %s, %s},\n' % (mod, is_package, getter))
+        outfp.write('\n')
+        for mod in fail_import:
+            outfp.write('\t{"%s", NULL, 0},\n' % (mod,))
+        outfp.write(trailer)
+        outfp.write(entry_point)
+    return [file]
+
+
+
 # Write a C initializer for a module containing the frozen python code.
 # The array is called M_<mod>.
 
@@ -166,14 +166,15 @@ def prepare(script=None, outdir=None):
     return outdir, scriptfile, python
 
 
-def freeze(python, scriptfile, outdir):
+def freeze(python, scriptfile, outdir, *, deepfreeze=False):
     if not MAKE:
         raise UnsupportedError('make')
 
     print(f'freezing {scriptfile}...')
     os.makedirs(outdir, exist_ok=True)
+    opts = ['-F'] if deepfreeze else []
     # Use -E to ignore PYTHONSAFEPATH
-    _run_quiet([python, '-E', FREEZE, '-o', outdir, scriptfile], outdir)
+    _run_quiet([python, '-E', FREEZE, *opts, '-o', outdir, scriptfile], outdir)
     _run_quiet([MAKE, '-C', os.path.dirname(scriptfile)])
 
     name = os.path.basename(scriptfile).rpartition('.')[0]
@@ -0,0 +1,160 @@
+"""Micro-benchmarks for thread locks.
+
+Each benchmark times acquire()/release() pairs of a lock, either from a
+single thread or from several threads competing for the same lock.  It
+should not be used as an overall benchmark of threading performance, but
+rather as an easy way to measure the impact of changes to the lock
+implementation (see sys.thread_info.lock).
+"""
+
+import argparse
+import queue
+import sys
+import threading
+import time
+
+
+def uncontended_lock(n, nthreads):
+    """Lock acquire/release, single thread"""
+    lock = threading.Lock()
+    acquire = lock.acquire
+    release = lock.release
+    t0 = time.perf_counter()
+    for _ in range(n):
+        acquire()
+        release()
+    return time.perf_counter() - t0
+
+def uncontended_rlock(n, nthreads):
+    """RLock acquire/release, single thread"""
+    lock = threading.RLock()
+    acquire = lock.acquire
+    release = lock.release
+    t0 = time.perf_counter()
+    for _ in range(n):
+        acquire()
+        release()
+    return time.perf_counter() - t0
+
+def uncontended_timeout(n, nthreads):
+    """Lock acquire(timeout=1)/release, single thread"""
+    lock = threading.Lock()
+    acquire = lock.acquire
+    release = lock.release
+    t0 = time.perf_counter()
+    for _ in range(n):
+        acquire(timeout=1.0)
+        release()
+    return time.perf_counter() - t0
+
+def _run_threads(nthreads, target):
+    threads = [threading.Thread(target=target) for _ in range(nthreads)]
+    t0 = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return time.perf_counter() - t0
+
+def contended_lock(n, nthreads):
+    """Lock acquire/release, all threads"""
+    lock = threading.Lock()
+    def worker():
+        acquire = lock.acquire
+        release = lock.release
+        for _ in range(n // nthreads):
+            acquire()
+            release()
+    return _run_threads(nthreads, worker)
+
+def contended_rlock(n, nthreads):
+    """RLock acquire/release, all threads"""
+    lock = threading.RLock()
+    def worker():
+        acquire = lock.acquire
+        release = lock.release
+        for _ in range(n // nthreads):
+            acquire()
+            release()
+    return _run_threads(nthreads, worker)
+
+def handoff(n, nthreads):
+    """Lock released by another thread (ping-pong)"""
+    ping = threading.Lock()
+    pong = threading.Lock()
+    ping.acquire()
+    pong.acquire()
+    count = n // 10
+    def other():
+        for _ in range(count):
+            ping.acquire()
+            pong.release()
+    t = threading.Thread(target=other)
+    t0 = time.perf_counter()
+    t.start()
+    for _ in range(count):
+        ping.release()
+        pong.acquire()
+    t.join()
+    return time.perf_counter() - t0
+
+def queue_put_get(n, nthreads):
+    """queue.Queue put/get, one producer per thread"""
+    q = queue.Queue()
+    count = n // 10 // nthreads
+    def producer():
+        put = q.put
+        for i in range(count):
+            put(i)
+    threads = [threading.Thread(target=producer) for _ in range(nthreads)]
+    t0 = time.perf_counter()
+    for t in threads:
+        t.start()
+    get = q.get
+    for _ in range(count * nthreads):
+        get()
+    for t in threads:
+        t.join()
+    return time.perf_counter() - t0
+
+
+BENCHMARKS = [uncontended_lock, uncontended_rlock, uncontended_timeout,
+              contended_lock, contended_rlock, handoff, queue_put_get]
+
+
+def timeit(func, n, nthreads, repeat):
+    return min(func(n, nthreads) for _ in range(repeat))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=1_000_000,
+                        help='number of acquire/release pairs '
+                             '(default: %(default)s)')
+    parser.add_argument('-t', '--threads', type=int, default=4,
+                        help='number of threads of the contended '
+                             'benchmarks (default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of runs, the best is reported '
+                             '(default: %(default)s)')
+    parser.add_argument('benchmarks', nargs='*',
+                        help='benchmarks to run (default: all)')
+    args = parser.parse_args()
+
+    benchmarks = BENCHMARKS
+    if args.benchmarks:
+        names = {func.__name__: func for func in BENCHMARKS}
+        try:
+            benchmarks = [names[name] for name in args.benchmarks]
+        except KeyError as exc:
+            parser.error('unknown benchmark: %s' % exc)
+
+    print('lock implementation: %s' % sys.thread_info.lock)
+    print('%-20s %-45s %10s' % ('name', 'description', 'ms'))
+    for func in benchmarks:
+        dt = timeit(func, args.number, args.threads, args.repeat)
+        print('%-20s %-45s %10.1f' % (func.__name__, func.__doc__, dt * 1e3))
+
+
+if __name__ == '__main__':
+    main()
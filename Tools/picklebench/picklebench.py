@@ -0,0 +1,114 @@
+"""Micro-benchmarks for pickling and unpickling large object graphs.
+
+Each benchmark builds one large object and times pickle.dumps() and
+pickle.loads() on it.  It should not be used as an overall benchmark of
+pickle performance, but rather as an easy way to measure the impact of
+changes to the pickler, such as its memo table.
+"""
+
+import argparse
+import pickle
+import time
+
+
+class Record:
+    def __init__(self, i):
+        self.id = i
+        self.name = 'record-%d' % i
+        self.tags = ['a', 'b']
+
+
+def ints(n):
+    """list of small ints"""
+    return list(range(n))
+
+def floats(n):
+    """list of floats"""
+    return [i / 7 for i in range(n)]
+
+def strings(n):
+    """list of distinct strings"""
+    return ['s%d' % i for i in range(n)]
+
+def tuples(n):
+    """list of (int, float, str) tuples"""
+    return [(i, i / 7, 'v%d' % i) for i in range(n)]
+
+def dicts(n):
+    """list of dicts sharing their keys"""
+    return [{'id': i, 'name': 'n%d' % i, 'score': i / 7} for i in range(n)]
+
+def shared(n):
+    """list of references to a few hundred tuples"""
+    pool = [('x%d' % i,) for i in range(256)]
+    return [pool[i % 256] for i in range(n)]
+
+def tree(n):
+    """nested lists"""
+    def build(depth):
+        if depth == 0:
+            return ['leaf']
+        return [build(depth - 1), build(depth - 1)]
+    depth = max(1, n.bit_length() - 1)
+    return build(depth)
+
+def instances(n):
+    """list of instances of a Python class"""
+    return [Record(i) for i in range(n)]
+
+
+BENCHMARKS = [ints, floats, strings, tuples, dicts, shared, tree, instances]
+
+
+def timeit(func, repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--size', type=int, default=200_000,
+                        help='number of objects in each graph '
+                             '(default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of runs, the best is reported '
+                             '(default: %(default)s)')
+    parser.add_argument('-p', '--protocol', type=int,
+                        default=pickle.HIGHEST_PROTOCOL,
+                        help='pickle protocol (default: %(default)s)')
+    parser.add_argument('--pure', action='store_true',
+                        help='benchmark the pure Python implementation')
+    parser.add_argument('benchmarks', nargs='*',
+                        help='benchmarks to run (default: all)')
+    args = parser.parse_args()
+
+    if args.pure:
+        dumps, loads = pickle._dumps, pickle._loads
+    else:
+        dumps, loads = pickle.dumps, pickle.loads
+    benchmarks = BENCHMARKS
+    if args.benchmarks:
+        names = {func.__name__: func for func in BENCHMARKS}
+        try:
+            benchmarks = [names[name] for name in args.benchmarks]
+        except KeyError as exc:
+            parser.error('unknown benchmark: %s' % exc)
+
+    print('%-10s %-45s %10s %10s %10s' %
+          ('name', 'description', 'size', 'dumps ms', 'loads ms'))
+    for func in benchmarks:
+        obj = func(args.size)
+        data = dumps(obj, args.protocol)
+        t_dumps = timeit(lambda: dumps(obj, args.protocol), args.repeat)
+        t_loads = timeit(lambda: loads(data), args.repeat)
+        print('%-10s %-45s %10d %10.1f %10.1f' %
+              (func.__name__, func.__doc__, len(data),
+               t_dumps * 1e3, t_loads * 1e3))
+
+
+if __name__ == '__main__':
+    main()